@@ -0,0 +1,874 @@
+// Micro-benchmarks dos caminhos quentes do nível mestre. Liga com a mesma biblioteca
+// do jogo (libdetective.a) para medir as mesmas funções, com as mesmas otimizações do
+// compilador: "make release" gera build/release/benchmark
+#define _POSIX_C_SOURCE 200809L  // mkstemp, fdopen e clock_gettime
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "nucleo/caso.h"
+#include "nucleo/niveis.h"
+#include "nucleo/dicas.h"
+#include "nucleo/suspeitos.h"
+#include "nucleo/rotas.h"
+#include "nucleo/busca.h"
+
+#define AMOSTRA_OPERACOES 128            // Operações cronometradas juntas em cada amostra de latência
+#define MAX_TAMANHOS 16                  // Máximo de tamanhos pedidos com --pistas
+#define JOGOS_PADRAO 2000                // Partidas reproduzidas por tamanho
+#define REPETICOES_PADRAO 5              // Passadas completas nos testes O(n) por chamada
+#define SUSPEITOS_POR_PISTA 50           // Uma pista em cada 50 aponta para um suspeito novo
+
+// Amostras de um teste: cada uma é o tempo de um grupo de operações
+typedef struct Medicao {
+    double* amostras;             // Nanossegundos por operação em cada amostra
+    size_t quantidade;
+    size_t capacidade;
+    double totalNs;               // Tempo somado de todas as amostras
+    uint64_t operacoes;           // Operações somadas de todas as amostras
+} Medicao;
+
+// Dados sintéticos de um tamanho: textos de pistas e de suspeitos
+typedef struct DadosSinteticos {
+    char** pistas;                // Texto de cada pista
+    char** nomesSuspeitos;        // Texto de cada suspeito
+    uint32_t numPistas;
+    uint32_t numSuspeitos;
+    char* texto;                  // Buffer único com todos os textos
+} DadosSinteticos;
+
+// Teste registrado na lista de benchmarks
+typedef struct Benchmark {
+    const char* nome;
+    void (*executar)(uint32_t n, Medicao* medicao);
+} Benchmark;
+
+// Configurações da linha de comando
+uint32_t tamanhos[MAX_TAMANHOS];
+int numTamanhos = 0;
+int numJogos = JOGOS_PADRAO;
+int numRepeticoes = REPETICOES_PADRAO;
+double custoRelogio = 0;          // Custo de uma leitura do relógio (descontado das amostras)
+volatile uint64_t sumidouro;      // Impede que o compilador descarte resultados não usados
+
+/*
+ * Função: agoraNs
+ * Propósito: Lê o relógio monotônico
+ * Parâmetros: void
+ * Retorno: instante atual em nanossegundos
+ */
+static inline double agoraNs() {
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec * 1e9 + instante.tv_nsec;
+}
+
+/*
+ * Função: calibrarRelogio
+ * Propósito: Estima o custo de uma leitura do relógio (menor intervalo vazio observado)
+ * Parâmetros: void
+ * Retorno: void
+ */
+void calibrarRelogio() {
+    double menor = 1e9;
+    for (int i = 0; i < 10000; i++) {
+        double inicio = agoraNs();
+        double fim = agoraNs();
+        if (fim - inicio < menor) {
+            menor = fim - inicio;
+        }
+    }
+    custoRelogio = menor;
+}
+
+/*
+ * Função: proximoAleatorio
+ * Propósito: Gerador xorshift64 (determinístico, para execuções comparáveis)
+ * Parâmetros: estado - estado do gerador (diferente de 0)
+ * Retorno: próximo valor pseudoaleatório
+ */
+static inline uint64_t proximoAleatorio(uint64_t* estado) {
+    uint64_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *estado = x;
+    return x;
+}
+
+/*
+ * Função: embaralhar
+ * Propósito: Embaralha um vetor de identificadores (Fisher-Yates)
+ * Parâmetros: valores - vetor a embaralhar
+ *            quantidade - número de elementos
+ *            semente - semente do gerador
+ * Retorno: void
+ */
+void embaralhar(uint32_t* valores, uint32_t quantidade, uint64_t semente) {
+    uint64_t estado = semente;
+    for (uint32_t i = quantidade; i > 1; i--) {
+        uint32_t j = (uint32_t)(proximoAleatorio(&estado) % i);
+        uint32_t troca = valores[i - 1];
+        valores[i - 1] = valores[j];
+        valores[j] = troca;
+    }
+}
+
+/*
+ * Função: alocarOuSair
+ * Propósito: Aloca memória para os dados de um teste, encerrando em caso de falha
+ * Parâmetros: tamanho - bytes a alocar
+ * Retorno: ponteiro para a memória alocada
+ */
+void* alocarOuSair(size_t tamanho) {
+    void* memoria = malloc(tamanho > 0 ? tamanho : 1);
+    if (memoria == NULL) {
+        printf("Erro: Não foi possível alocar memória para o benchmark.\n");
+        exit(1);
+    }
+    return memoria;
+}
+
+/*
+ * Função: registrarAmostra
+ * Propósito: Guarda o tempo de um grupo de operações (descontando a leitura do relógio)
+ * Parâmetros: medicao - medição em andamento
+ *            inicio, fim - instantes antes e depois do grupo
+ *            operacoes - operações executadas no grupo
+ * Retorno: void
+ */
+void registrarAmostra(Medicao* medicao, double inicio, double fim, uint64_t operacoes) {
+    if (operacoes == 0) {
+        return;
+    }
+    double decorrido = fim - inicio - custoRelogio;
+    if (decorrido < 0) {
+        decorrido = 0;
+    }
+    if (medicao->quantidade == medicao->capacidade) {
+        medicao->capacidade = medicao->capacidade > 0 ? medicao->capacidade * 2 : 1024;
+        medicao->amostras = (double*)realloc(medicao->amostras, medicao->capacidade * sizeof(double));
+        if (medicao->amostras == NULL) {
+            printf("Erro: Não foi possível alocar memória para as amostras.\n");
+            exit(1);
+        }
+    }
+    medicao->amostras[medicao->quantidade++] = decorrido / operacoes;
+    medicao->totalNs += decorrido;
+    medicao->operacoes += operacoes;
+}
+
+/*
+ * Função: compararAmostras
+ * Propósito: Ordena amostras de latência em ordem crescente (para qsort)
+ * Parâmetros: a, b - ponteiros para as amostras
+ * Retorno: negativo, zero ou positivo
+ */
+int compararAmostras(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Função: percentil
+ * Propósito: Consulta um percentil das amostras já ordenadas (posto mais próximo)
+ * Parâmetros: medicao - medição com amostras ordenadas
+ *            p - percentil (0 a 100)
+ * Retorno: latência do percentil em ns por operação
+ */
+double percentil(const Medicao* medicao, double p) {
+    if (medicao->quantidade == 0) {
+        return 0;
+    }
+    size_t posto = (size_t)(p / 100.0 * medicao->quantidade + 0.5);
+    if (posto < 1) {
+        posto = 1;
+    }
+    if (posto > medicao->quantidade) {
+        posto = medicao->quantidade;
+    }
+    return medicao->amostras[posto - 1];
+}
+
+/*
+ * Função: gerarDados
+ * Propósito: Cria os textos de n pistas e dos suspeitos correspondentes
+ * Parâmetros: dados - estrutura a preencher
+ *            n - número de pistas
+ * Retorno: void
+ */
+void gerarDados(DadosSinteticos* dados, uint32_t n) {
+    dados->numPistas = n;
+    dados->numSuspeitos = n / SUSPEITOS_POR_PISTA > 0 ? n / SUSPEITOS_POR_PISTA : 1;
+    dados->pistas = (char**)alocarOuSair(n * sizeof(char*));
+    dados->nomesSuspeitos = (char**)alocarOuSair(dados->numSuspeitos * sizeof(char*));
+    dados->texto = (char*)alocarOuSair(((size_t)n + dados->numSuspeitos) * 32);
+    
+    char* livre = dados->texto;
+    for (uint32_t i = 0; i < n; i++) {
+        dados->pistas[i] = livre;
+        livre += sprintf(livre, "Pista %08u", i) + 1;
+    }
+    for (uint32_t i = 0; i < dados->numSuspeitos; i++) {
+        dados->nomesSuspeitos[i] = livre;
+        livre += sprintf(livre, "Suspeito %u", i) + 1;
+    }
+}
+
+/*
+ * Função: liberarDados
+ * Propósito: Libera os textos sintéticos
+ * Parâmetros: dados - estrutura preenchida por gerarDados
+ * Retorno: void
+ */
+void liberarDados(DadosSinteticos* dados) {
+    free(dados->pistas);
+    free(dados->nomesSuspeitos);
+    free(dados->texto);
+}
+
+/*
+ * Função: prepararTabela
+ * Propósito: Monta a tabela de strings e a tabela pista -> suspeito (fora da medição)
+ * Parâmetros: dados - textos sintéticos
+ * Retorno: void
+ */
+void prepararTabela(const DadosSinteticos* dados) {
+    inicializarTabelaStrings();
+    inicializarTabelaHash();
+    for (uint32_t i = 0; i < dados->numPistas; i++) {
+        inserirNaHash(dados->pistas[i], dados->nomesSuspeitos[i % dados->numSuspeitos]);
+    }
+}
+
+/*
+ * Função: idsEmbaralhados
+ * Propósito: Lista os identificadores internados das pistas em ordem aleatória
+ * Parâmetros: dados - textos sintéticos (já internados)
+ * Retorno: vetor com numPistas identificadores (liberado por quem chama)
+ */
+uint32_t* idsEmbaralhados(const DadosSinteticos* dados) {
+    uint32_t* ids = (uint32_t*)alocarOuSair(dados->numPistas * sizeof(uint32_t));
+    for (uint32_t i = 0; i < dados->numPistas; i++) {
+        ids[i] = buscarString(dados->pistas[i]);
+    }
+    embaralhar(ids, dados->numPistas, 0x9e3779b97f4a7c15ull);
+    return ids;
+}
+
+/*
+ * Função: montarInventario
+ * Propósito: Insere todas as pistas em uma árvore AVL (fora da medição)
+ * Parâmetros: arena - arena dona dos nós
+ *            ids - identificadores das pistas
+ *            quantidade - número de pistas
+ * Retorno: raiz da árvore montada
+ */
+PistaNode* montarInventario(Arena* arena, const uint32_t* ids, uint32_t quantidade) {
+    PistaNode* raiz = NULL;
+    for (uint32_t i = 0; i < quantidade; i++) {
+        raiz = inserirPista(arena, raiz, ids[i]);
+    }
+    return raiz;
+}
+
+/*
+ * Função: medirFuncaoHash
+ * Propósito: Mede funcaoHash sobre os textos de n pistas
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirFuncaoHash(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    
+    uint64_t acumulado = 0;
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < n ? i + AMOSTRA_OPERACOES : n;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            acumulado ^= funcaoHash(dados.pistas[j]);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = acumulado;
+    
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirInsercaoHash
+ * Propósito: Mede inserirNaHash (internação dos textos e associação) a partir de tabelas vazias
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirInsercaoHash(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    inicializarTabelaStrings();
+    inicializarTabelaHash();
+    
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < n ? i + AMOSTRA_OPERACOES : n;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            inserirNaHash(dados.pistas[j], dados.nomesSuspeitos[j % dados.numSuspeitos]);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirEncontrarSuspeito
+ * Propósito: Mede encontrarSuspeito (busca pelo texto) em ordem aleatória
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirEncontrarSuspeito(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    prepararTabela(&dados);
+    uint32_t* ordem = idsEmbaralhados(&dados);
+    
+    uint64_t encontrados = 0;
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < n ? i + AMOSTRA_OPERACOES : n;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            encontrados += encontrarSuspeito(textoDaString(ordem[j])) != NULL;
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = encontrados;
+    
+    free(ordem);
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirBuscaEmLote
+ * Propósito: Mede buscarSuspeitosEmLote (pistas já internadas) em ordem aleatória
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirBuscaEmLote(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    prepararTabela(&dados);
+    uint32_t* ordem = idsEmbaralhados(&dados);
+    int* idsSuspeitos = (int*)alocarOuSair(n * sizeof(int));
+    
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t quantidade = i + AMOSTRA_OPERACOES < n ? AMOSTRA_OPERACOES : n - i;
+        double inicio = agoraNs();
+        buscarSuspeitosEmLote(&ordem[i], quantidade, &idsSuspeitos[i]);
+        registrarAmostra(medicao, inicio, agoraNs(), quantidade);
+    }
+    sumidouro = (uint64_t)idsSuspeitos[n - 1];
+    
+    free(idsSuspeitos);
+    free(ordem);
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirInserirPista
+ * Propósito: Mede inserirPista na árvore AVL do inventário, em ordem aleatória
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirInserirPista(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    inicializarTabelaStrings();
+    for (uint32_t i = 0; i < n; i++) {
+        internarString(dados.pistas[i]);
+    }
+    uint32_t* ordem = idsEmbaralhados(&dados);
+    
+    Arena arena = {NULL};
+    PistaNode* raiz = NULL;
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < n ? i + AMOSTRA_OPERACOES : n;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            raiz = inserirPista(&arena, raiz, ordem[j]);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = (uint64_t)contarPistas(raiz);
+    
+    liberarArena(&arena);
+    free(ordem);
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirInserirPistaPersistente
+ * Propósito: Mede inserirPistaPersistente (a inserção usada no jogo, que copia o caminho
+ *            para a jogada (v)), em ordem aleatória; o pico de memória inclui as versões
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirInserirPistaPersistente(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    inicializarTabelaStrings();
+    for (uint32_t i = 0; i < n; i++) {
+        internarString(dados.pistas[i]);
+    }
+    uint32_t* ordem = idsEmbaralhados(&dados);
+    
+    Arena arena = {NULL};
+    PistaNode* raiz = NULL;
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < n ? i + AMOSTRA_OPERACOES : n;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            raiz = inserirPistaPersistente(&arena, raiz, ordem[j]);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = (uint64_t)contarPistas(raiz);
+    
+    liberarArena(&arena);
+    free(ordem);
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirContarPistas
+ * Propósito: Mede contarPistas sobre um inventário com n pistas
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirContarPistas(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    inicializarTabelaStrings();
+    for (uint32_t i = 0; i < n; i++) {
+        internarString(dados.pistas[i]);
+    }
+    uint32_t* ordem = idsEmbaralhados(&dados);
+    Arena arena = {NULL};
+    PistaNode* volatile raiz = montarInventario(&arena, ordem, n);
+    
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < n; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < n ? i + AMOSTRA_OPERACOES : n;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            total += (uint64_t)contarPistas(raiz);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = total;
+    
+    liberarArena(&arena);
+    free(ordem);
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: medirContarPorSuspeito
+ * Propósito: Mede contarPistasPorSuspeito (reconstrução completa dos contadores);
+ *            cada repetição é uma amostra, com custo dividido pelas n pistas
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirContarPorSuspeito(uint32_t n, Medicao* medicao) {
+    DadosSinteticos dados;
+    gerarDados(&dados, n);
+    prepararTabela(&dados);
+    uint32_t* ordem = idsEmbaralhados(&dados);
+    
+    Sessao sessao;
+    iniciarSessao(&sessao, &NIVEL_MESTRE, NULL, NULL);
+    sessao.raizPistas = montarInventario(&sessao.arena, ordem, n);
+    
+    for (int r = 0; r < numRepeticoes; r++) {
+        zerarContadores(&sessao);
+        double inicio = agoraNs();
+        contarPistasPorSuspeito(&sessao, sessao.raizPistas);
+        registrarAmostra(medicao, inicio, agoraNs(), n);
+    }
+    sumidouro = (uint64_t)sessao.contagemSuspeitos[0];
+    
+    encerrarSessao(&sessao);
+    free(ordem);
+    liberarCaso();
+    liberarDados(&dados);
+}
+
+/*
+ * Função: gerarCaso
+ * Propósito: Escreve um arquivo de caso sintético: árvore binária completa em que
+ *            2 de cada 3 salas têm uma pista (salas = pistas * 3 / 2)
+ * Parâmetros: arquivo - destino do caso em texto
+ *            numSalas - número de salas
+ * Retorno: void
+ */
+void gerarCaso(FILE* arquivo, uint32_t numSalas) {
+    uint32_t numPistas = numSalas - (numSalas + 2) / 3;
+    uint32_t numSuspeitos = numPistas / SUSPEITOS_POR_PISTA > 0 ? numPistas / SUSPEITOS_POR_PISTA : 1;
+    
+    for (uint32_t i = 0; i < numSalas; i++) {
+        if (i % 3 != 0) {
+            fprintf(arquivo, "S\t%u\tSala %u\tPista %08u\n", i, i, i);
+        } else {
+            fprintf(arquivo, "S\t%u\tSala %u\n", i, i);
+        }
+    }
+    for (uint32_t i = 0; 2 * (uint64_t)i + 1 < numSalas; i++) {
+        if (2 * i + 2 < numSalas) {
+            fprintf(arquivo, "L\t%u\t%u\t%u\n", i, 2 * i + 1, 2 * i + 2);
+        } else {
+            fprintf(arquivo, "L\t%u\t%u\t-\n", i, 2 * i + 1);
+        }
+    }
+    for (uint32_t i = 0, k = 0; i < numSalas; i++) {
+        if (i % 3 != 0) {
+            fprintf(arquivo, "P\tPista %08u\tSuspeito %u\n", i, k++ % numSuspeitos);
+        }
+    }
+}
+
+/*
+ * Função: medirPartidas
+ * Propósito: Mede a reprodução de partidas completas (modo lote silencioso) em uma
+ *            mansão sintética com n pistas: cada partida desce por um caminho
+ *            aleatório até uma sala sem saída e faz a acusação
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras (uma por partida, em ns por jogada)
+ * Retorno: void
+ */
+void medirPartidas(uint32_t n, Medicao* medicao) {
+    char caminho[] = "/tmp/benchmark_caso_XXXXXX";
+    int descritor = mkstemp(caminho);
+    FILE* arquivo = descritor >= 0 ? fdopen(descritor, "w") : NULL;
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível criar o caso sintético.\n");
+        exit(1);
+    }
+    gerarCaso(arquivo, n + n / 2);
+    fclose(arquivo);
+    carregarCaso(caminho);
+    unlink(caminho);
+    
+    // Roteiros gerados antes da medição, em um único buffer
+    size_t capacidade = (size_t)numJogos * 80;
+    char* roteiros = (char*)alocarOuSair(capacidade);
+    char** inicios = (char**)alocarOuSair(numJogos * sizeof(char*));
+    uint32_t* jogadas = (uint32_t*)alocarOuSair(numJogos * sizeof(uint32_t));
+    uint64_t estado = 0x2545f4914f6cdd1dull;
+    size_t livre = 0;
+    for (int jogo = 0; jogo < numJogos; jogo++) {
+        inicios[jogo] = &roteiros[livre];
+        jogadas[jogo] = 0;
+        for (uint32_t id = 0; id != SEM_SALA; jogadas[jogo]++) {
+            const Sala* sala = &mansao.salas[id];
+            int direita = sala->direita != SEM_SALA && (proximoAleatorio(&estado) & 1);
+            if (sala->esquerda == SEM_SALA && sala->direita == SEM_SALA) {
+                break;
+            }
+            roteiros[livre++] = direita || sala->esquerda == SEM_SALA ? 'd' : 'e';
+            id = direita || sala->esquerda == SEM_SALA ? sala->direita : sala->esquerda;
+        }
+        livre += sprintf(&roteiros[livre], "s1") + 1;
+        jogadas[jogo] += 2;
+    }
+    
+    uint64_t resolvidas = 0;
+    for (int jogo = 0; jogo < numJogos; jogo++) {
+        Sessao sessao;
+        double inicio = agoraNs();
+        iniciarSessao(&sessao, &NIVEL_MESTRE, NULL, inicios[jogo]);
+        jogarSessao(&sessao);
+        encerrarSessao(&sessao);
+        registrarAmostra(medicao, inicio, agoraNs(), jogadas[jogo]);
+        resolvidas += sessao.pistasDoAcusado >= 2;
+    }
+    sumidouro = resolvidas;
+    
+    free(jogadas);
+    free(inicios);
+    free(roteiros);
+    liberarCaso();
+}
+
+/*
+ * Função: medirRotasCondenacao
+ * Propósito: Mede tracarRotaCondenacao a partir de salas aleatórias da mansão sintética
+ *            (as tabelas do motor de rotas são montadas antes, fora da medição)
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras (ns por rota)
+ * Retorno: void
+ */
+void medirRotasCondenacao(uint32_t n, Medicao* medicao) {
+    char caminho[] = "/tmp/benchmark_caso_XXXXXX";
+    int descritor = mkstemp(caminho);
+    FILE* arquivo = descritor >= 0 ? fdopen(descritor, "w") : NULL;
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível criar o caso sintético.\n");
+        exit(1);
+    }
+    gerarCaso(arquivo, n + n / 2);
+    fclose(arquivo);
+    carregarCaso(caminho);
+    unlink(caminho);
+    garantirRotas();
+    
+    uint32_t* origens = (uint32_t*)alocarOuSair(mansao.quantidade * sizeof(uint32_t));
+    for (uint32_t id = 0; id < mansao.quantidade; id++) {
+        origens[id] = id;
+    }
+    embaralhar(origens, mansao.quantidade, 0x9e3779b97f4a7c15ull);
+    
+    uint32_t numRotas = n < mansao.quantidade ? n : mansao.quantidade;
+    uint64_t passosTotais = 0;
+    for (uint32_t i = 0; i < numRotas; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < numRotas ? i + AMOSTRA_OPERACOES : numRotas;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            uint32_t passos = 0;
+            int suspeito;
+            uint32_t* rota = tracarRotaCondenacao(origens[j], &passos, &suspeito);
+            passosTotais += passos;
+            free(rota);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = passosTotais;
+    
+    free(origens);
+    liberarCaso();
+}
+
+/*
+ * Função: medirBuscaPistas
+ * Propósito: Mede buscarPistas em uma sessão que coletou metade das pistas da mansão
+ *            sintética (o índice da sessão é montado antes, fora da medição)
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras (ns por consulta)
+ *            prefixo - 1 para prefixos ("pista 0001234", até 10 pistas), 0 para trechos
+ *                      de 6 dígitos (poucas pistas, entre muitas com os mesmos dígitos)
+ * Retorno: void
+ */
+void medirBuscaPistas(uint32_t n, Medicao* medicao, int prefixo) {
+    char caminho[] = "/tmp/benchmark_caso_XXXXXX";
+    int descritor = mkstemp(caminho);
+    FILE* arquivo = descritor >= 0 ? fdopen(descritor, "w") : NULL;
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível criar o caso sintético.\n");
+        exit(1);
+    }
+    gerarCaso(arquivo, n + n / 2);
+    fclose(arquivo);
+    carregarCaso(caminho);
+    unlink(caminho);
+    
+    uint32_t* alvos = (uint32_t*)alocarOuSair(mansao.quantidade * sizeof(uint32_t));
+    uint32_t numColetadas = 0;
+    for (uint32_t id = 1; id < mansao.quantidade; id += 3) {
+        alvos[numColetadas++] = mansao.salas[id].pista;
+    }
+    Sessao sessao;
+    iniciarSessao(&sessao, &NIVEL_MESTRE, NULL, NULL);
+    sessao.raizPistas = montarInventario(&sessao.arena, alvos, numColetadas);
+    buscaDaSessao(&sessao);
+    
+    uint32_t* resultado = (uint32_t*)alocarOuSair(((size_t)numColetadas + 1) * sizeof(uint32_t));
+    for (uint32_t id = 0; id < mansao.quantidade; id++) {
+        alvos[id] = id;
+    }
+    embaralhar(alvos, mansao.quantidade, 0x2545f4914f6cdd1dull);
+    
+    uint32_t numConsultas = n < mansao.quantidade ? n : mansao.quantidade;
+    uint64_t encontradas = 0;
+    char consulta[32];
+    for (uint32_t i = 0; i < numConsultas; i += AMOSTRA_OPERACOES) {
+        uint32_t fim = i + AMOSTRA_OPERACOES < numConsultas ? i + AMOSTRA_OPERACOES : numConsultas;
+        double inicio = agoraNs();
+        for (uint32_t j = i; j < fim; j++) {
+            if (prefixo) {
+                snprintf(consulta, sizeof(consulta), "pista %07u", alvos[j] / 10);
+            } else {
+                snprintf(consulta, sizeof(consulta), "%06u", alvos[j] % 1000000);
+            }
+            encontradas += buscarPistas(&sessao, consulta, prefixo, resultado, numColetadas);
+        }
+        registrarAmostra(medicao, inicio, agoraNs(), fim - i);
+    }
+    sumidouro = encontradas;
+    
+    free(alvos);
+    free(resultado);
+    encerrarSessao(&sessao);
+    liberarCaso();
+}
+
+/*
+ * Função: medirBuscaPrefixo
+ * Propósito: Mede buscarPistas com prefixos (ver medirBuscaPistas)
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirBuscaPrefixo(uint32_t n, Medicao* medicao) {
+    medirBuscaPistas(n, medicao, 1);
+}
+
+/*
+ * Função: medirBuscaTrecho
+ * Propósito: Mede buscarPistas com trechos (ver medirBuscaPistas)
+ * Parâmetros: n - número de pistas
+ *            medicao - recebe as amostras
+ * Retorno: void
+ */
+void medirBuscaTrecho(uint32_t n, Medicao* medicao) {
+    medirBuscaPistas(n, medicao, 0);
+}
+
+// Testes na ordem de execução
+const Benchmark benchmarks[] = {
+    {"funcaoHash", medirFuncaoHash},
+    {"inserirNaHash", medirInsercaoHash},
+    {"encontrarSuspeito", medirEncontrarSuspeito},
+    {"buscarSuspeitosEmLote", medirBuscaEmLote},
+    {"inserirPista", medirInserirPista},
+    {"inserirPistaPersistente", medirInserirPistaPersistente},
+    {"contarPistas", medirContarPistas},
+    {"contarPistasPorSuspeito", medirContarPorSuspeito},
+    {"partida (jogadas)", medirPartidas},
+    {"tracarRotaCondenacao", medirRotasCondenacao},
+    {"buscarPistas (prefixo)", medirBuscaPrefixo},
+    {"buscarPistas (trecho)", medirBuscaTrecho},
+};
+
+/*
+ * Função: executarBenchmark
+ * Propósito: Executa um teste em um processo filho, para que o pico de memória
+ *            residente medido seja só o dele, e exibe o resultado
+ * Parâmetros: benchmark - teste a executar
+ *            n - número de pistas
+ * Retorno: void
+ */
+void executarBenchmark(const Benchmark* benchmark, uint32_t n) {
+    fflush(stdout);
+    pid_t filho = fork();
+    if (filho < 0) {
+        printf("Erro: Não foi possível criar o processo do benchmark.\n");
+        exit(1);
+    }
+    
+    if (filho == 0) {
+        Medicao medicao = {0};
+        benchmark->executar(n, &medicao);
+        qsort(medicao.amostras, medicao.quantidade, sizeof(double), compararAmostras);
+    
+        struct rusage uso;
+        getrusage(RUSAGE_SELF, &uso);
+        printf("%-24s %10u %10.1f %10.1f %10.1f %10.1f\n", benchmark->nome, n,
+               medicao.operacoes > 0 ? medicao.totalNs / medicao.operacoes : 0,
+               percentil(&medicao, 50), percentil(&medicao, 99), uso.ru_maxrss / 1024.0);
+        free(medicao.amostras);
+        exit(0);
+    }
+    
+    int status;
+    waitpid(filho, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        printf("%-24s %10u   (falhou)\n", benchmark->nome, n);
+    }
+}
+
+/*
+ * Função: lerInteiroPositivo
+ * Propósito: Converte um argumento numérico da linha de comando
+ * Parâmetros: texto - argumento
+ *            opcao - nome da opção (para a mensagem de erro)
+ * Retorno: valor lido (entre 1 e UINT32_MAX)
+ */
+uint32_t lerInteiroPositivo(const char* texto, const char* opcao) {
+    char* fim;
+    unsigned long long valor = strtoull(texto, &fim, 10);
+    if (*texto == '\0' || *fim != '\0' || valor == 0 || valor > UINT32_MAX) {
+        printf("Erro: valor inválido para %s: '%s'.\n", opcao, texto);
+        exit(1);
+    }
+    return (uint32_t)valor;
+}
+
+/*
+ * Função: main
+ * Propósito: Interpreta as opções e executa os benchmarks para cada tamanho
+ * Retorno: 0 se execução bem-sucedida
+ */
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--pistas") == 0 && i + 1 < argc) {
+            if (numTamanhos == MAX_TAMANHOS) {
+                printf("Erro: no máximo %d tamanhos.\n", MAX_TAMANHOS);
+                return 1;
+            }
+            tamanhos[numTamanhos++] = lerInteiroPositivo(argv[++i], "--pistas");
+        } else if (strcmp(argv[i], "--jogos") == 0 && i + 1 < argc) {
+            numJogos = (int)lerInteiroPositivo(argv[++i], "--jogos");
+        } else if (strcmp(argv[i], "--repeticoes") == 0 && i + 1 < argc) {
+            numRepeticoes = (int)lerInteiroPositivo(argv[++i], "--repeticoes");
+        } else if (strcmp(argv[i], "--gerar") == 0 && i + 2 < argc) {
+            // Apenas escreve um caso sintético (para jogar, compilar ou resolver)
+            FILE* arquivo = fopen(argv[i + 1], "w");
+            if (arquivo == NULL) {
+                printf("Erro: Não foi possível criar '%s'.\n", argv[i + 1]);
+                return 1;
+            }
+            gerarCaso(arquivo, lerInteiroPositivo(argv[i + 2], "--gerar"));
+            fclose(arquivo);
+            return 0;
+        } else {
+            printf("Uso: %s [--pistas N]... [--jogos N] [--repeticoes N]\n", argv[0]);
+            printf("     %s --gerar <caso.txt> <salas>\n", argv[0]);
+            return 1;
+        }
+    }
+    if (numTamanhos == 0) {
+        uint32_t padrao[] = {1000, 10000, 100000, 1000000};
+        for (int i = 0; i < 4; i++) {
+            tamanhos[numTamanhos++] = padrao[i];
+        }
+    }
+    
+    calibrarRelogio();
+    printf("%-24s %10s %10s %10s %10s %10s\n", "Teste", "Pistas", "ns/op", "p50 (ns)", "p99 (ns)", "RSS (MiB)");
+    for (int t = 0; t < numTamanhos; t++) {
+        for (size_t b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++) {
+            executarBenchmark(&benchmarks[b], tamanhos[t]);
+        }
+    }
+    
+    return 0;
+}
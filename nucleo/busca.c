@@ -0,0 +1,627 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "busca.h"
+#include "suspeitos.h"
+#include "niveis.h"
+
+// Letra sem acento de cada caractere U+00C0..U+00FF (em UTF-8, 0xC3 seguido de 0x80..0xBF);
+// '-' mantém o caractere (só passado para minúscula)
+static const char SEM_ACENTO[64] = "aaaaaa-ceeeeiiii-nooooo--uuuuy--aaaaaa-ceeeeiiii-nooooo--uuuuy-y";
+
+/*
+ * Função: normalizarTexto
+ * Propósito: Escreve o texto sem maiúsculas nem acentos (letras latinas em UTF-8), para
+ *            que "Faca", "FACA" e "faça" sejam encontradas pela mesma busca
+ * Parâmetros: texto - texto original (terminado em '\0')
+ *            destino - recebe o texto normalizado (nunca maior que o original)
+ * Retorno: bytes escritos em "destino" (sem contar o '\0')
+ */
+size_t normalizarTexto(const char* texto, char* destino) {
+    const unsigned char* origem = (const unsigned char*)texto;
+    size_t tamanho = 0;
+    
+    while (*origem != '\0') {
+        if (*origem == 0xC3 && origem[1] >= 0x80 && origem[1] <= 0xBF) {
+            char base = SEM_ACENTO[origem[1] - 0x80];
+            if (base != '-') {
+                destino[tamanho++] = base;
+            } else {
+                // Sem letra base (Æ, Ø, ß...): só as maiúsculas U+00C0..U+00DE viram minúsculas
+                destino[tamanho++] = (char)0xC3;
+                destino[tamanho++] = (char)(origem[1] < 0x9F && origem[1] != 0x97 ? origem[1] + 0x20 : origem[1]);
+            }
+            origem += 2;
+        } else {
+            destino[tamanho++] = (char)(*origem >= 'A' && *origem <= 'Z' ? *origem + ('a' - 'A') : *origem);
+            origem++;
+        }
+    }
+    destino[tamanho] = '\0';
+    return tamanho;
+}
+
+/*
+ * Função: compararChaveBusca
+ * Propósito: Compara uma chave (texto normalizado, pista) com a de um nó de busca
+ * Parâmetros: texto - texto normalizado da chave
+ *            pista - pista dona do texto (desempate)
+ *            no - nó comparado
+ * Retorno: negativo, zero ou positivo, como strcmp
+ */
+int compararChaveBusca(const char* texto, uint32_t pista, const NoBusca* no) {
+    int diferenca = strcmp(texto, no->texto);
+    if (diferenca != 0) {
+        return diferenca;
+    }
+    return (pista > no->pista) - (pista < no->pista);
+}
+
+/*
+ * Função: compararNosBusca
+ * Propósito: Ordena ponteiros para nós de busca pela chave (qsort)
+ * Parâmetros: a, b - ponteiros para ponteiros de nós
+ * Retorno: negativo, zero ou positivo, no padrão do qsort
+ */
+int compararNosBusca(const void* a, const void* b) {
+    const NoBusca* noA = *(NoBusca* const*)a;
+    return compararChaveBusca(noA->texto, noA->pista, *(NoBusca* const*)b);
+}
+
+/*
+ * Função: alturaNoBusca
+ * Propósito: Obtém a altura de uma subárvore de busca
+ * Parâmetros: no - raiz da subárvore (pode ser NULL)
+ * Retorno: altura da subárvore (0 se vazia)
+ */
+int alturaNoBusca(const NoBusca* no) {
+    return no != NULL ? no->altura : 0;
+}
+
+/*
+ * Função: atualizarNoBusca
+ * Propósito: Recalcula a altura de um nó a partir dos filhos
+ * Parâmetros: no - nó a ser atualizado
+ * Retorno: void
+ */
+void atualizarNoBusca(NoBusca* no) {
+    int alturaEsquerda = alturaNoBusca(no->esquerda);
+    int alturaDireita = alturaNoBusca(no->direita);
+    no->altura = 1 + (alturaEsquerda > alturaDireita ? alturaEsquerda : alturaDireita);
+}
+
+/*
+ * Função: rotacionarBusca
+ * Propósito: Rotaciona uma subárvore de busca
+ * Parâmetros: no - raiz da subárvore desbalanceada
+ *            paraDireita - 1 para o filho esquerdo subir, 0 para o direito
+ * Retorno: nova raiz da subárvore
+ */
+NoBusca* rotacionarBusca(NoBusca* no, int paraDireita) {
+    NoBusca* novaRaiz;
+    if (paraDireita) {
+        novaRaiz = no->esquerda;
+        no->esquerda = novaRaiz->direita;
+        novaRaiz->direita = no;
+    } else {
+        novaRaiz = no->direita;
+        no->direita = novaRaiz->esquerda;
+        novaRaiz->esquerda = no;
+    }
+    atualizarNoBusca(no);
+    atualizarNoBusca(novaRaiz);
+    return novaRaiz;
+}
+
+/*
+ * Função: balancearNoBusca
+ * Propósito: Atualiza a altura do nó e aplica as rotações AVL necessárias
+ * Parâmetros: no - raiz da subárvore
+ * Retorno: nova raiz da subárvore balanceada
+ */
+NoBusca* balancearNoBusca(NoBusca* no) {
+    atualizarNoBusca(no);
+    int fator = alturaNoBusca(no->esquerda) - alturaNoBusca(no->direita);
+    
+    if (fator > 1) {
+        // Caso esquerda-direita: rotação dupla
+        if (alturaNoBusca(no->esquerda->esquerda) < alturaNoBusca(no->esquerda->direita)) {
+            no->esquerda = rotacionarBusca(no->esquerda, 0);
+        }
+        return rotacionarBusca(no, 1);
+    }
+    if (fator < -1) {
+        // Caso direita-esquerda: rotação dupla
+        if (alturaNoBusca(no->direita->direita) < alturaNoBusca(no->direita->esquerda)) {
+            no->direita = rotacionarBusca(no->direita, 1);
+        }
+        return rotacionarBusca(no, 0);
+    }
+    
+    return no;
+}
+
+/*
+ * Função: criarNoBusca
+ * Propósito: Cria um nó de busca, reaproveitando um de pista desfeita se houver
+ * Parâmetros: busca - índice da sessão dono do nó
+ *            texto - texto normalizado a partir do nó
+ *            pista - pista dona do texto
+ *            deslocamento - início de "texto" no texto normalizado da pista
+ * Retorno: nó criado (folha)
+ */
+NoBusca* criarNoBusca(BuscaSessao* busca, char* texto, uint32_t pista, uint32_t deslocamento) {
+    NoBusca* no = busca->livres;
+    if (no != NULL) {
+        busca->livres = no->direita;
+    } else {
+        no = (NoBusca*)alocarNaArena(&busca->arena, sizeof(NoBusca));
+    }
+    
+    no->texto = texto;
+    no->pista = pista;
+    no->deslocamento = deslocamento;
+    no->altura = 1;
+    no->esquerda = NULL;
+    no->direita = NULL;
+    return no;
+}
+
+/*
+ * Função: inserirNoBusca
+ * Propósito: Insere um nó em uma árvore de busca (recursão de altura O(log n))
+ * Parâmetros: raiz - raiz da árvore
+ *            novo - nó a inserir (a chave não pode estar na árvore)
+ * Retorno: nova raiz da árvore
+ */
+NoBusca* inserirNoBusca(NoBusca* raiz, NoBusca* novo) {
+    if (raiz == NULL) {
+        return novo;
+    }
+    
+    if (compararChaveBusca(novo->texto, novo->pista, raiz) < 0) {
+        raiz->esquerda = inserirNoBusca(raiz->esquerda, novo);
+    } else {
+        raiz->direita = inserirNoBusca(raiz->direita, novo);
+    }
+    return balancearNoBusca(raiz);
+}
+
+/*
+ * Função: removerMenorBusca
+ * Propósito: Retira o menor nó de uma subárvore de busca
+ * Parâmetros: raiz - raiz da subárvore (não vazia)
+ *            menor - recebe o nó retirado
+ * Retorno: nova raiz da subárvore
+ */
+NoBusca* removerMenorBusca(NoBusca* raiz, NoBusca** menor) {
+    if (raiz->esquerda == NULL) {
+        *menor = raiz;
+        return raiz->direita;
+    }
+    
+    raiz->esquerda = removerMenorBusca(raiz->esquerda, menor);
+    return balancearNoBusca(raiz);
+}
+
+/*
+ * Função: removerNoBusca
+ * Propósito: Retira de uma árvore de busca o nó de uma chave (o sucessor ocupa o lugar
+ *            de um nó com dois filhos)
+ * Parâmetros: raiz - raiz da árvore
+ *            texto, pista - chave do nó
+ *            removido - recebe o nó retirado (NULL se a chave não está na árvore)
+ * Retorno: nova raiz da árvore
+ */
+NoBusca* removerNoBusca(NoBusca* raiz, const char* texto, uint32_t pista, NoBusca** removido) {
+    if (raiz == NULL) {
+        *removido = NULL;
+        return NULL;
+    }
+    
+    int comparacao = compararChaveBusca(texto, pista, raiz);
+    if (comparacao < 0) {
+        raiz->esquerda = removerNoBusca(raiz->esquerda, texto, pista, removido);
+    } else if (comparacao > 0) {
+        raiz->direita = removerNoBusca(raiz->direita, texto, pista, removido);
+    } else {
+        *removido = raiz;
+        if (raiz->esquerda == NULL || raiz->direita == NULL) {
+            return raiz->esquerda != NULL ? raiz->esquerda : raiz->direita;
+        }
+        NoBusca* sucessor;
+        NoBusca* direita = removerMenorBusca(raiz->direita, &sucessor);
+        sucessor->esquerda = raiz->esquerda;
+        sucessor->direita = direita;
+        raiz = sucessor;
+    }
+    return balancearNoBusca(raiz);
+}
+
+/*
+ * Função: montarNosBusca
+ * Propósito: Monta uma árvore de busca perfeitamente balanceada a partir de nós já
+ *            ordenados pela chave, sem comparações nem rotações
+ * Parâmetros: nos - nós em ordem crescente de chave
+ *            quantidade - número de nós
+ * Retorno: raiz da árvore montada (NULL se quantidade == 0)
+ */
+NoBusca* montarNosBusca(NoBusca** nos, size_t quantidade) {
+    if (quantidade == 0) {
+        return NULL;
+    }
+    
+    size_t meio = quantidade / 2;
+    NoBusca* no = nos[meio];
+    no->esquerda = montarNosBusca(nos, meio);
+    no->direita = montarNosBusca(nos + meio + 1, quantidade - meio - 1);
+    atualizarNoBusca(no);
+    
+    return no;
+}
+
+/*
+ * Função: normalizarPista
+ * Propósito: Copia o texto normalizado de uma pista para um buffer próprio
+ * Parâmetros: pista - identificador da pista
+ *            tamanho - recebe os bytes do texto normalizado (sem o '\0')
+ * Retorno: texto normalizado (liberado por quem chamou)
+ */
+char* normalizarPista(uint32_t pista, size_t* tamanho) {
+    const char* original = textoDaString(pista);
+    char* texto = (char*)malloc(strlen(original) + 1);
+    if (texto == NULL) {
+        printf("Erro: Não foi possível alocar memória para o índice de busca.\n");
+        exit(1);
+    }
+    *tamanho = normalizarTexto(original, texto);
+    return texto;
+}
+
+/*
+ * Função: marcarPistaBusca
+ * Propósito: Acrescenta ou retira uma pista do índice de busca de uma sessão: o texto
+ *            normalizado e cada um dos seus sufixos, O(tamanho do texto * log n)
+ * Parâmetros: busca - índice da sessão
+ *            pista - pista coletada ou desfeita
+ *            coletada - 1 ao coletar, 0 ao desfazer
+ * Retorno: void
+ */
+void marcarPistaBusca(BuscaSessao* busca, uint32_t pista, int coletada) {
+    size_t tamanho;
+    char* texto = normalizarPista(pista, &tamanho);
+    
+    if (coletada) {
+        busca->textos = inserirNoBusca(busca->textos, criarNoBusca(busca, texto, pista, 0));
+        for (size_t i = 0; i < tamanho; i++) {
+            busca->sufixos = inserirNoBusca(busca->sufixos, criarNoBusca(busca, texto + i, pista, (uint32_t)i));
+        }
+        return;
+    }
+    
+    // O texto guardado é o do nó retirado; os sufixos apontam para ele
+    NoBusca* removido;
+    busca->textos = removerNoBusca(busca->textos, texto, pista, &removido);
+    free(texto);
+    if (removido == NULL) {
+        return;
+    }
+    texto = removido->texto;
+    removido->direita = busca->livres;
+    busca->livres = removido;
+    for (size_t i = 0; i < tamanho; i++) {
+        busca->sufixos = removerNoBusca(busca->sufixos, texto + i, pista, &removido);
+        removido->direita = busca->livres;
+        busca->livres = removido;
+    }
+    free(texto);
+}
+
+/*
+ * Função: buscaDaSessao
+ * Propósito: Obtém o índice de busca da sessão, criando-o na primeira busca a partir do
+ *            inventário atual: os nós são ordenados uma vez e montados já balanceados
+ *            (depois o índice acompanha cada pista coletada ou desfeita)
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: índice de busca da sessão
+ */
+BuscaSessao* buscaDaSessao(Sessao* sessao) {
+    if (sessao->busca != NULL) {
+        return sessao->busca;
+    }
+    
+    BuscaSessao* busca = (BuscaSessao*)malloc(sizeof(BuscaSessao));
+    if (busca == NULL) {
+        printf("Erro: Não foi possível alocar memória para o índice de busca.\n");
+        exit(1);
+    }
+    busca->textos = NULL;
+    busca->sufixos = NULL;
+    busca->arena.atual = NULL;
+    busca->livres = NULL;
+    sessao->busca = busca;
+    
+    int numPistas = contarPistas(sessao->raizPistas);
+    if (numPistas == 0) {
+        return busca;
+    }
+    uint32_t* pistas = (uint32_t*)malloc((size_t)numPistas * sizeof(uint32_t));
+    char** normalizados = (char**)malloc((size_t)numPistas * sizeof(char*));
+    size_t* tamanhos = (size_t*)malloc((size_t)numPistas * sizeof(size_t));
+    NoBusca** textos = (NoBusca**)malloc((size_t)numPistas * sizeof(NoBusca*));
+    if (pistas == NULL || normalizados == NULL || tamanhos == NULL || textos == NULL) {
+        printf("Erro: Não foi possível alocar memória para o índice de busca.\n");
+        exit(1);
+    }
+    listarPistasEmOrdem(sessao->raizPistas, pistas);
+    size_t numSufixos = 0;
+    for (int i = 0; i < numPistas; i++) {
+        normalizados[i] = normalizarPista(pistas[i], &tamanhos[i]);
+        textos[i] = criarNoBusca(busca, normalizados[i], pistas[i], 0);
+        numSufixos += tamanhos[i];
+    }
+    
+    NoBusca** sufixos = (NoBusca**)malloc((numSufixos + 1) * sizeof(NoBusca*));
+    if (sufixos == NULL) {
+        printf("Erro: Não foi possível alocar memória para o índice de busca.\n");
+        exit(1);
+    }
+    size_t k = 0;
+    for (int i = 0; i < numPistas; i++) {
+        for (size_t j = 0; j < tamanhos[i]; j++) {
+            sufixos[k++] = criarNoBusca(busca, normalizados[i] + j, pistas[i], (uint32_t)j);
+        }
+    }
+    qsort(textos, (size_t)numPistas, sizeof(NoBusca*), compararNosBusca);
+    qsort(sufixos, numSufixos, sizeof(NoBusca*), compararNosBusca);
+    busca->textos = montarNosBusca(textos, (size_t)numPistas);
+    busca->sufixos = montarNosBusca(sufixos, numSufixos);
+    
+    free(pistas);
+    free(normalizados);
+    free(tamanhos);
+    free(textos);
+    free(sufixos);
+    return busca;
+}
+
+/*
+ * Função: descerAoIntervalo
+ * Propósito: Desce pela árvore até o primeiro nó cujo texto começa com a consulta (ou
+ *            é maior que ela), empilhando os ancestrais pelos quais o percurso em ordem
+ *            continua
+ * Parâmetros: raiz - raiz da árvore de busca
+ *            consulta - texto normalizado
+ *            tamanho - bytes da consulta
+ *            pilha - recebe o percurso (capacidade ALTURA_MAXIMA_AVL)
+ * Retorno: número de nós empilhados
+ */
+int descerAoIntervalo(NoBusca* raiz, const char* consulta, size_t tamanho, NoBusca** pilha) {
+    int topo = 0;
+    for (NoBusca* no = raiz; no != NULL; ) {
+        if (strncmp(no->texto, consulta, tamanho) >= 0) {
+            pilha[topo++] = no;
+            no = no->esquerda;
+        } else {
+            no = no->direita;
+        }
+    }
+    return topo;
+}
+
+/*
+ * Função: proximoNoBusca
+ * Propósito: Avança o percurso em ordem iniciado por descerAoIntervalo
+ * Parâmetros: pilha - percurso em andamento
+ *            topo - número de nós empilhados (atualizado)
+ * Retorno: próximo nó em ordem (NULL no fim da árvore)
+ */
+NoBusca* proximoNoBusca(NoBusca** pilha, int* topo) {
+    if (*topo == 0) {
+        return NULL;
+    }
+    
+    NoBusca* no = pilha[--*topo];
+    for (NoBusca* filho = no->direita; filho != NULL; filho = filho->esquerda) {
+        pilha[(*topo)++] = filho;
+    }
+    return no;
+}
+
+/*
+ * Função: compararOcorrencias
+ * Propósito: Ordena sufixos encontrados pela chave da pista dona (texto normalizado
+ *            inteiro, depois identificador), o que junta as ocorrências de cada pista
+ * Parâmetros: a, b - ponteiros para ponteiros de nós de sufixo
+ * Retorno: negativo, zero ou positivo, no padrão do qsort
+ */
+int compararOcorrencias(const void* a, const void* b) {
+    const NoBusca* noA = *(NoBusca* const*)a;
+    const NoBusca* noB = *(NoBusca* const*)b;
+    int diferenca = strcmp(noA->texto - noA->deslocamento, noB->texto - noB->deslocamento);
+    if (diferenca != 0) {
+        return diferenca;
+    }
+    return (noA->pista > noB->pista) - (noA->pista < noB->pista);
+}
+
+/*
+ * Função: buscarPistas
+ * Propósito: Lista as pistas coletadas que começam com a consulta ou que a contêm, sem
+ *            diferenciar maiúsculas nem acentos, em ordem alfabética. O custo é o do
+ *            resultado: um prefixo é um intervalo da árvore de textos e um trecho, um
+ *            intervalo da árvore de sufixos, e só ele é percorrido (um trecho repetido
+ *            na mesma pista é visitado uma vez por ocorrência)
+ * Parâmetros: sessao - investigação em andamento
+ *            consulta - texto procurado
+ *            prefixo - 1 para buscar pelo início da pista, 0 para qualquer trecho
+ *            resultado - recebe as pistas encontradas
+ *            limite - capacidade de "resultado" (com o inventário inteiro, nada se perde)
+ * Retorno: quantidade de pistas escritas em "resultado"
+ */
+uint32_t buscarPistas(Sessao* sessao, const char* consulta, int prefixo, uint32_t* resultado, uint32_t limite) {
+    BuscaSessao* busca = buscaDaSessao(sessao);
+    char normalizada[MAX_CONSULTA_BUSCA];
+    size_t tamanho = normalizarTexto(consulta, normalizada);
+    NoBusca* pilha[ALTURA_MAXIMA_AVL];
+    uint32_t total = 0;
+    
+    if (prefixo || tamanho == 0) {
+        int topo = descerAoIntervalo(busca->textos, normalizada, tamanho, pilha);
+        for (NoBusca* no = proximoNoBusca(pilha, &topo);
+             no != NULL && total < limite && strncmp(no->texto, normalizada, tamanho) == 0;
+             no = proximoNoBusca(pilha, &topo)) {
+            resultado[total++] = no->pista;
+        }
+        return total;
+    }
+    
+    // Cada sufixo do intervalo é uma ocorrência; ordenadas pela pista, cada pista entra uma vez
+    size_t numOcorrencias = 0, capacidade = 16;
+    NoBusca** ocorrencias = (NoBusca**)malloc(capacidade * sizeof(NoBusca*));
+    if (ocorrencias == NULL) {
+        printf("Erro: Não foi possível alocar memória para a busca.\n");
+        exit(1);
+    }
+    int topo = descerAoIntervalo(busca->sufixos, normalizada, tamanho, pilha);
+    for (NoBusca* no = proximoNoBusca(pilha, &topo); no != NULL && strncmp(no->texto, normalizada, tamanho) == 0;
+         no = proximoNoBusca(pilha, &topo)) {
+        if (numOcorrencias == capacidade) {
+            capacidade *= 2;
+            NoBusca** novas = (NoBusca**)realloc(ocorrencias, capacidade * sizeof(NoBusca*));
+            if (novas == NULL) {
+                printf("Erro: Não foi possível alocar memória para a busca.\n");
+                exit(1);
+            }
+            ocorrencias = novas;
+        }
+        ocorrencias[numOcorrencias++] = no;
+    }
+    
+    qsort(ocorrencias, numOcorrencias, sizeof(NoBusca*), compararOcorrencias);
+    for (size_t i = 0; i < numOcorrencias && total < limite; i++) {
+        if (i == 0 || ocorrencias[i]->pista != ocorrencias[i - 1]->pista) {
+            resultado[total++] = ocorrencias[i]->pista;
+        }
+    }
+    free(ocorrencias);
+    return total;
+}
+
+/*
+ * Função: lerConsultaBusca
+ * Propósito: Lê o texto da jogada (b): o resto da linha (no roteiro, até ';' ou o fim da
+ *            linha); no teclado, se a linha acabou, pede a consulta em uma nova linha
+ * Parâmetros: sessao - investigação em andamento
+ *            consulta - recebe o texto, sem espaços nas pontas
+ * Retorno: 1 se uma consulta foi lida, 0 se a entrada terminou
+ */
+int lerConsultaBusca(Sessao* sessao, char consulta[MAX_CONSULTA_BUSCA]) {
+    size_t tamanho = 0;
+    
+    if (sessao->roteiro != NULL) {
+        const char* texto = sessao->roteiro;
+        while (texto[sessao->posicaoRoteiro] == ' ' || texto[sessao->posicaoRoteiro] == '\t') {
+            sessao->posicaoRoteiro++;
+        }
+        for (char c = texto[sessao->posicaoRoteiro]; c != '\0' && c != '\n' && c != ';';
+             c = texto[++sessao->posicaoRoteiro]) {
+            if (tamanho < MAX_CONSULTA_BUSCA - 1) {
+                consulta[tamanho++] = c;
+            }
+        }
+        if (texto[sessao->posicaoRoteiro] == ';') {
+            sessao->posicaoRoteiro++;
+        }
+    } else {
+        int c = getchar();
+        while (c == ' ' || c == '\t') {
+            c = getchar();
+        }
+        if (c == '\n') {
+            mostrar(sessao, "Buscar nas pistas (termine com * para buscar pelo início): ");
+            c = getchar();
+        }
+        if (c == EOF) {
+            return 0;
+        }
+        for (; c != EOF && c != '\n'; c = getchar()) {
+            if (tamanho < MAX_CONSULTA_BUSCA - 1) {
+                consulta[tamanho++] = (char)c;
+            }
+        }
+    }
+    
+    while (tamanho > 0 && (consulta[tamanho - 1] == ' ' || consulta[tamanho - 1] == '\t'
+                           || consulta[tamanho - 1] == '\r')) {
+        tamanho--;
+    }
+    consulta[tamanho] = '\0';
+    return 1;
+}
+
+/*
+ * Função: mostrarBusca
+ * Propósito: Jogada (b): lê a consulta e mostra as pistas coletadas que a contêm ou,
+ *            terminada em '*', que começam com ela
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: void
+ */
+void mostrarBusca(Sessao* sessao) {
+    char consulta[MAX_CONSULTA_BUSCA];
+    if (!lerConsultaBusca(sessao, consulta)) {
+        return;
+    }
+    size_t tamanho = strlen(consulta);
+    int prefixo = tamanho > 0 && consulta[tamanho - 1] == '*';
+    if (prefixo) {
+        consulta[tamanho - 1] = '\0';
+    }
+    
+    int totalPistas = contarPistas(sessao->raizPistas);
+    uint32_t* resultado = (uint32_t*)malloc(((size_t)totalPistas + 1) * sizeof(uint32_t));
+    if (resultado == NULL) {
+        printf("Erro: Não foi possível alocar memória para a busca.\n");
+        exit(1);
+    }
+    uint32_t encontradas = buscarPistas(sessao, consulta, prefixo, resultado, (uint32_t)totalPistas);
+    
+    mostrar(sessao, "\n🔎 BUSCA: pistas que %s \"%s\" (%u de %d)\n", prefixo ? "começam com" : "contêm",
+            consulta, encontradas, totalPistas);
+    for (uint32_t i = 0; i < encontradas; i++) {
+        mostrar(sessao, "  • %s", textoDaString(resultado[i]));
+        HashNode* associacao = sessao->nivel->apontaSuspeitos ? buscarNaHash(resultado[i]) : NULL;
+        if (associacao != NULL) {
+            mostrar(sessao, " → %s", textoDaString(suspeitos.nomes[associacao->idSuspeito]));
+        }
+        mostrar(sessao, "\n");
+    }
+    if (encontradas == 0) {
+        mostrar(sessao, "   Nenhuma pista coletada corresponde à busca.\n");
+    }
+    free(resultado);
+}
+
+/*
+ * Função: liberarBuscaSessao
+ * Propósito: Libera o índice de busca de uma sessão (se alguma busca o criou): os textos
+ *            normalizados, guardados nos nós da árvore de textos, e a arena dos nós
+ * Parâmetros: sessao - investigação
+ * Retorno: void
+ */
+void liberarBuscaSessao(Sessao* sessao) {
+    BuscaSessao* busca = sessao->busca;
+    if (busca == NULL) {
+        return;
+    }
+    
+    NoBusca* pilha[ALTURA_MAXIMA_AVL];
+    int topo = descerAoIntervalo(busca->textos, "", 0, pilha);
+    for (NoBusca* no = proximoNoBusca(pilha, &topo); no != NULL; no = proximoNoBusca(pilha, &topo)) {
+        free(no->texto);
+    }
+    liberarArena(&busca->arena);
+    free(busca);
+    sessao->busca = NULL;
+}
@@ -0,0 +1,56 @@
+#ifndef NUCLEO_BUSCA_H
+#define NUCLEO_BUSCA_H
+
+#include <stdint.h>
+
+#include "memoria.h"
+#include "sessao.h"
+
+#define MAX_CONSULTA_BUSCA 256           // Bytes de uma consulta (o excedente é ignorado)
+
+// Nó das árvores AVL de busca de uma sessão. A chave é um texto normalizado (sem
+// maiúsculas nem acentos), com a pista dona dele como desempate: os textos que começam
+// com uma mesma consulta formam um intervalo contíguo da ordem
+typedef struct NoBusca {
+    char* texto;                  // Texto normalizado a partir deste nó (terminado em '\0')
+    uint32_t pista;               // Pista dona do texto
+    uint32_t deslocamento;        // Início de "texto" dentro do texto normalizado da pista
+    int altura;                   // Altura da subárvore (balanceamento AVL)
+    struct NoBusca* esquerda;
+    struct NoBusca* direita;
+} NoBusca;
+
+// Índice das pistas coletadas de uma sessão, criado na primeira busca a partir do
+// inventário e mantido a cada pista coletada ou desfeita. Só as pistas coletadas entram
+// nele, então memória e montagem acompanham o inventário, não o caso
+struct BuscaSessao {
+    NoBusca* textos;              // Texto normalizado inteiro de cada pista (buscas por prefixo)
+    NoBusca* sufixos;             // Cada sufixo não vazio desses textos (buscas por trecho)
+    Arena arena;                  // Dona dos nós
+    NoBusca* livres;              // Nós de pistas desfeitas, reaproveitados (ligados por "direita")
+};
+
+size_t normalizarTexto(const char* texto, char* destino);
+int compararChaveBusca(const char* texto, uint32_t pista, const NoBusca* no);
+int compararNosBusca(const void* a, const void* b);
+int alturaNoBusca(const NoBusca* no);
+void atualizarNoBusca(NoBusca* no);
+NoBusca* rotacionarBusca(NoBusca* no, int paraDireita);
+NoBusca* balancearNoBusca(NoBusca* no);
+NoBusca* criarNoBusca(BuscaSessao* busca, char* texto, uint32_t pista, uint32_t deslocamento);
+NoBusca* inserirNoBusca(NoBusca* raiz, NoBusca* novo);
+NoBusca* removerMenorBusca(NoBusca* raiz, NoBusca** menor);
+NoBusca* removerNoBusca(NoBusca* raiz, const char* texto, uint32_t pista, NoBusca** removido);
+NoBusca* montarNosBusca(NoBusca** nos, size_t quantidade);
+char* normalizarPista(uint32_t pista, size_t* tamanho);
+void marcarPistaBusca(BuscaSessao* busca, uint32_t pista, int coletada);
+BuscaSessao* buscaDaSessao(Sessao* sessao);
+int descerAoIntervalo(NoBusca* raiz, const char* consulta, size_t tamanho, NoBusca** pilha);
+NoBusca* proximoNoBusca(NoBusca** pilha, int* topo);
+int compararOcorrencias(const void* a, const void* b);
+uint32_t buscarPistas(Sessao* sessao, const char* consulta, int prefixo, uint32_t* resultado, uint32_t limite);
+int lerConsultaBusca(Sessao* sessao, char consulta[MAX_CONSULTA_BUSCA]);
+void mostrarBusca(Sessao* sessao);
+void liberarBuscaSessao(Sessao* sessao);
+
+#endif
@@ -0,0 +1,431 @@
+#define _POSIX_C_SOURCE 200809L  // fmemopen
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "caso.h"
+#include "suspeitos.h"
+#include "dicas.h"
+#include "rotas.h"
+
+void* imagemMapeada = NULL;      // Imagem compilada em uso (NULL se o caso veio de texto)
+size_t tamanhoImagem = 0;
+uint32_t geracaoCaso = 0;        // Conta os casos carregados; os caches derivados guardam a sua
+
+/*
+ * Função: escreverSecao
+ * Propósito: Grava uma seção da imagem, completando com zeros até o próximo alinhamento
+ * Parâmetros: arquivo - arquivo de imagem aberto para escrita
+ *            dados - conteúdo da seção
+ *            tamanho - tamanho do conteúdo em bytes
+ * Retorno: 1 em caso de sucesso, 0 em caso de erro de escrita
+ */
+int escreverSecao(FILE* arquivo, const void* dados, uint64_t tamanho) {
+    static const char zeros[ALINHAMENTO_SECAO] = {0};
+    size_t preenchimento = (ALINHAMENTO_SECAO - tamanho % ALINHAMENTO_SECAO) % ALINHAMENTO_SECAO;
+    
+    if (tamanho > 0 && fwrite(dados, 1, tamanho, arquivo) != tamanho) {
+        return 0;
+    }
+    return fwrite(zeros, 1, preenchimento, arquivo) == preenchimento;
+}
+
+/*
+ * Função: compilarCaso
+ * Propósito: Grava o caso carregado (salas, saídas, strings, tabela hash e suspeitos) em uma
+ *            imagem binária sem ponteiros, pronta para ser mapeada com mmap
+ * Parâmetros: caminho - caminho do arquivo de imagem a ser criado
+ * Retorno: 1 em caso de sucesso, 0 em caso de erro
+ */
+int compilarCaso(const char* caminho) {
+    CabecalhoImagem cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magico, MAGICO_IMAGEM, sizeof(cabecalho.magico));
+    cabecalho.versao = VERSAO_IMAGEM;
+    cabecalho.marcadorOrdem = MARCADOR_ORDEM;
+    cabecalho.numSalas = mansao.quantidade;
+    cabecalho.numStrings = strings.quantidade;
+    cabecalho.capacidadeIndiceStrings = strings.capacidadeIndice;
+    cabecalho.capacidadeHash = tabelaHash.capacidade;
+    cabecalho.ocupadasHash = tabelaHash.ocupadas;
+    cabecalho.numSuspeitos = suspeitos.quantidade;
+    cabecalho.capacidadeIndiceSuspeitos = suspeitos.capacidadeIndice;
+    cabecalho.ordemSalas = ordemSalas;
+    cabecalho.numSaidas = mansao.numSaidas;
+    
+    // Conteúdo de cada seção, na ordem do enum
+    const void* dados[NUM_SECOES] = {
+        mansao.salas, mansao.nomes, strings.texto, strings.deslocamentos, strings.hashes,
+        strings.indice, tabelaHash.entradas, suspeitos.nomes, suspeitos.indice,
+        mansao.inicioSaidas, mansao.saidas
+    };
+    uint64_t tamanhos[NUM_SECOES] = {
+        (uint64_t)mansao.quantidade * sizeof(Sala),
+        (uint64_t)mansao.quantidade * sizeof(uint32_t),
+        strings.tamanhoTexto,
+        (uint64_t)strings.quantidade * sizeof(uint32_t),
+        (uint64_t)strings.quantidade * sizeof(uint64_t),
+        (uint64_t)strings.capacidadeIndice * sizeof(uint32_t),
+        (uint64_t)tabelaHash.capacidade * sizeof(HashNode),
+        (uint64_t)suspeitos.quantidade * sizeof(uint32_t),
+        (uint64_t)suspeitos.capacidadeIndice * sizeof(int),
+        ((uint64_t)mansao.quantidade + 1) * sizeof(uint32_t),
+        (uint64_t)mansao.numSaidas * sizeof(uint32_t)
+    };
+    
+    // As seções começam logo após o cabeçalho, cada uma em uma nova linha de cache
+    uint64_t posicao = (sizeof(CabecalhoImagem) + ALINHAMENTO_SECAO - 1) / ALINHAMENTO_SECAO * ALINHAMENTO_SECAO;
+    for (int i = 0; i < NUM_SECOES; i++) {
+        cabecalho.secoes[i].deslocamento = posicao;
+        cabecalho.secoes[i].tamanho = tamanhos[i];
+        posicao += (tamanhos[i] + ALINHAMENTO_SECAO - 1) / ALINHAMENTO_SECAO * ALINHAMENTO_SECAO;
+    }
+    
+    FILE* arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL) {
+        return 0;
+    }
+    int ok = escreverSecao(arquivo, &cabecalho, sizeof(cabecalho));
+    for (int i = 0; i < NUM_SECOES && ok; i++) {
+        ok = escreverSecao(arquivo, dados[i], tamanhos[i]);
+    }
+    if (fclose(arquivo) != 0) {
+        ok = 0;
+    }
+    return ok;
+}
+
+/*
+ * Função: secaoValida
+ * Propósito: Confere se uma seção da imagem cabe no arquivo e tem o tamanho esperado
+ * Parâmetros: cabecalho - cabeçalho da imagem
+ *            secao - índice da seção
+ *            esperado - tamanho esperado em bytes
+ * Retorno: 1 se a seção é válida, 0 caso contrário
+ */
+int secaoValida(const CabecalhoImagem* cabecalho, int secao, uint64_t esperado) {
+    const SecaoImagem* s = &cabecalho->secoes[secao];
+    return s->tamanho == esperado
+        && s->deslocamento % ALINHAMENTO_SECAO == 0
+        && s->deslocamento <= tamanhoImagem
+        && s->tamanho <= tamanhoImagem - s->deslocamento;
+}
+
+/*
+ * Função: potenciaDeDois
+ * Propósito: Confere se uma capacidade de índice é uma potência de 2 não nula
+ * Parâmetros: valor - capacidade lida da imagem
+ * Retorno: 1 se é potência de 2, 0 caso contrário
+ */
+int potenciaDeDois(uint32_t valor) {
+    return valor != 0 && (valor & (valor - 1)) == 0;
+}
+
+/*
+ * Função: arvoresValidas
+ * Propósito: Confere, como o carregador de texto, que as ligações da imagem formam
+ *            árvores: nenhuma sala com duas entradas, a entrada sem pai e sem ciclos
+ * Parâmetros: void (filhos das salas já conferidos)
+ * Retorno: 1 se as ligações formam árvores, 0 caso contrário
+ */
+int arvoresValidas() {
+    uint32_t n = mansao.quantidade;
+    uint8_t* temPai = (uint8_t*)calloc(n, 1);
+    uint32_t* pilha = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (temPai == NULL || pilha == NULL) {
+        printf("Erro: Não foi possível alocar memória para a mansão.\n");
+        exit(1);
+    }
+    
+    int valida = 1;
+    for (uint32_t id = 0; id < n && valida; id++) {
+        uint32_t filhos[2] = {mansao.salas[id].esquerda, mansao.salas[id].direita};
+        for (int lado = 0; lado < 2; lado++) {
+            if (filhos[lado] == SEM_SALA) {
+                continue;
+            }
+            if (filhos[lado] == 0 || temPai[filhos[lado]]) {
+                valida = 0;
+            }
+            temPai[filhos[lado]] = 1;
+        }
+    }
+    
+    // Com no máximo um pai por sala, nenhuma é empilhada duas vezes; as que nenhuma
+    // raiz alcança estão em ciclos
+    uint32_t alcancadas = 0;
+    for (uint32_t raiz = 0; raiz < n && valida; raiz++) {
+        if (temPai[raiz]) {
+            continue;
+        }
+        uint32_t topo = 0;
+        pilha[topo++] = raiz;
+        while (topo > 0) {
+            const Sala* sala = &mansao.salas[pilha[--topo]];
+            alcancadas++;
+            if (sala->esquerda != SEM_SALA) {
+                pilha[topo++] = sala->esquerda;
+            }
+            if (sala->direita != SEM_SALA) {
+                pilha[topo++] = sala->direita;
+            }
+        }
+    }
+    free(temPai);
+    free(pilha);
+    return valida && alcancadas == n;
+}
+
+/*
+ * Função: conteudoValido
+ * Propósito: Confere o conteúdo da imagem já mapeada, para que um arquivo corrompido seja
+ *            recusado em vez de levar a acessos fora dos vetores: saídas, salas, strings,
+ *            tabelas, índices e a estrutura de árvore das ligações (passadas lineares)
+ * Parâmetros: void
+ * Retorno: 1 se a imagem é consistente, 0 caso contrário
+ */
+int conteudoValido() {
+    uint32_t numSalas = mansao.quantidade;
+    uint32_t numStrings = strings.quantidade;
+    uint32_t numSuspeitos = (uint32_t)suspeitos.quantidade;
+    
+    // Tabelas de endereçamento aberto: potência de 2 e ao menos uma posição livre (um caso
+    // sem suspeitos não chega a criar o índice deles)
+    if (!potenciaDeDois(strings.capacidadeIndice) || !potenciaDeDois(tabelaHash.capacidade)
+        || ((numSuspeitos > 0 || suspeitos.capacidadeIndice != 0) && !potenciaDeDois(suspeitos.capacidadeIndice))
+        || numStrings == 0
+        || numStrings >= strings.capacidadeIndice || tabelaHash.ocupadas >= tabelaHash.capacidade
+        || (numSuspeitos > 0 && numSuspeitos >= suspeitos.capacidadeIndice)) {
+        return 0;
+    }
+    
+    // Saídas (CSR): inícios crescentes até numSaidas e destinos dentro da mansão
+    if (mansao.inicioSaidas[0] != 0 || mansao.inicioSaidas[numSalas] != mansao.numSaidas) {
+        return 0;
+    }
+    for (uint32_t id = 0; id < numSalas; id++) {
+        if (mansao.inicioSaidas[id] > mansao.inicioSaidas[id + 1]) {
+            return 0;
+        }
+    }
+    for (uint32_t i = 0; i < mansao.numSaidas; i++) {
+        if (mansao.saidas[i] >= numSalas) {
+            return 0;
+        }
+    }
+    
+    // Salas: filhos, pistas e nomes
+    for (uint32_t id = 0; id < numSalas; id++) {
+        const Sala* sala = &mansao.salas[id];
+        if ((sala->esquerda != SEM_SALA && sala->esquerda >= numSalas)
+            || (sala->direita != SEM_SALA && sala->direita >= numSalas)
+            || sala->pista >= numStrings || mansao.nomes[id] >= numStrings) {
+            return 0;
+        }
+    }
+    if (!arvoresValidas()) {
+        return 0;
+    }
+    
+    // Strings: cada deslocamento dentro do texto, que termina em '\0'
+    if (strings.tamanhoTexto == 0 || strings.texto[strings.tamanhoTexto - 1] != '\0') {
+        return 0;
+    }
+    for (uint32_t i = 0; i < numStrings; i++) {
+        if (strings.deslocamentos[i] >= strings.tamanhoTexto) {
+            return 0;
+        }
+    }
+    // Índices: as posições ocupadas devem ser exatamente as contadas no cabeçalho, senão
+    // uma tabela cheia faria as sondagens nunca acharem uma posição livre
+    uint32_t ocupadas = 0;
+    for (uint32_t i = 0; i < strings.capacidadeIndice; i++) {
+        if (strings.indice[i] > numStrings) {
+            return 0;
+        }
+        ocupadas += strings.indice[i] != 0;
+    }
+    if (ocupadas != numStrings) {
+        return 0;
+    }
+    
+    // Tabela pista -> suspeito e registro de suspeitos
+    ocupadas = 0;
+    for (uint32_t i = 0; i < tabelaHash.capacidade; i++) {
+        const HashNode* entrada = &tabelaHash.entradas[i];
+        if (entrada->pista == STRING_VAZIA) {
+            continue;
+        }
+        if (entrada->pista >= numStrings || entrada->idSuspeito < 0
+            || (uint32_t)entrada->idSuspeito >= numSuspeitos) {
+            return 0;
+        }
+        ocupadas++;
+    }
+    if (ocupadas != tabelaHash.ocupadas) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < numSuspeitos; i++) {
+        if (suspeitos.nomes[i] >= numStrings) {
+            return 0;
+        }
+    }
+    ocupadas = 0;
+    for (uint32_t i = 0; i < suspeitos.capacidadeIndice; i++) {
+        if (suspeitos.indice[i] < 0 || (uint32_t)suspeitos.indice[i] > numSuspeitos) {
+            return 0;
+        }
+        ocupadas += suspeitos.indice[i] != 0;
+    }
+    return ocupadas == numSuspeitos;
+}
+
+/*
+ * Função: mapearImagem
+ * Propósito: Mapeia uma imagem compilada somente para leitura e aponta as estruturas
+ *            do jogo diretamente para ela (sem leitura, conversão ou alocação)
+ * Parâmetros: caminho - caminho do arquivo do caso
+ * Retorno: 1 se o arquivo é uma imagem e foi mapeado, 0 se não é uma imagem
+ */
+int mapearImagem(const char* caminho) {
+    int descritor = open(caminho, O_RDONLY);
+    if (descritor < 0) {
+        return 0;
+    }
+    
+    struct stat info;
+    char magico[8];
+    if (fstat(descritor, &info) != 0 || (size_t)info.st_size < sizeof(CabecalhoImagem)
+        || read(descritor, magico, sizeof(magico)) != (ssize_t)sizeof(magico)
+        || memcmp(magico, MAGICO_IMAGEM, sizeof(magico)) != 0) {
+        close(descritor);
+        return 0; // Não é uma imagem: deve ser um arquivo de caso em texto
+    }
+    
+    // MAP_SHARED somente leitura: processos com o mesmo caso dividem as mesmas páginas
+    tamanhoImagem = (size_t)info.st_size;
+    imagemMapeada = mmap(NULL, tamanhoImagem, PROT_READ, MAP_SHARED, descritor, 0);
+    close(descritor);
+    if (imagemMapeada == MAP_FAILED) {
+        printf("Erro: Não foi possível mapear a imagem do caso '%s'.\n", caminho);
+        exit(1);
+    }
+    
+    const CabecalhoImagem* cabecalho = (const CabecalhoImagem*)imagemMapeada;
+    if (cabecalho->versao != VERSAO_IMAGEM || cabecalho->marcadorOrdem != MARCADOR_ORDEM) {
+        printf("Erro: a imagem '%s' foi gerada por outra versão ou arquitetura; compile o caso novamente.\n", caminho);
+        exit(1);
+    }
+    uint64_t tamanhoTexto = cabecalho->secoes[SECAO_TEXTO].tamanho;
+    if (cabecalho->numSalas == 0
+        || !secaoValida(cabecalho, SECAO_SALAS, (uint64_t)cabecalho->numSalas * sizeof(Sala))
+        || !secaoValida(cabecalho, SECAO_NOMES_SALAS, (uint64_t)cabecalho->numSalas * sizeof(uint32_t))
+        || !secaoValida(cabecalho, SECAO_TEXTO, tamanhoTexto)
+        || !secaoValida(cabecalho, SECAO_DESLOCAMENTOS, (uint64_t)cabecalho->numStrings * sizeof(uint32_t))
+        || !secaoValida(cabecalho, SECAO_HASHES, (uint64_t)cabecalho->numStrings * sizeof(uint64_t))
+        || !secaoValida(cabecalho, SECAO_INDICE_STRINGS, (uint64_t)cabecalho->capacidadeIndiceStrings * sizeof(uint32_t))
+        || !secaoValida(cabecalho, SECAO_ENTRADAS_HASH, (uint64_t)cabecalho->capacidadeHash * sizeof(HashNode))
+        || !secaoValida(cabecalho, SECAO_NOMES_SUSPEITOS, (uint64_t)cabecalho->numSuspeitos * sizeof(uint32_t))
+        || !secaoValida(cabecalho, SECAO_INDICE_SUSPEITOS, (uint64_t)cabecalho->capacidadeIndiceSuspeitos * sizeof(int))
+        || !secaoValida(cabecalho, SECAO_INICIO_SAIDAS, ((uint64_t)cabecalho->numSalas + 1) * sizeof(uint32_t))
+        || !secaoValida(cabecalho, SECAO_SAIDAS, (uint64_t)cabecalho->numSaidas * sizeof(uint32_t))
+        || cabecalho->ordemSalas > ORDEM_VEB) {
+        printf("Erro: a imagem do caso '%s' está corrompida.\n", caminho);
+        exit(1);
+    }
+    
+    // As estruturas passam a apontar para dentro do mapeamento (somente leitura)
+    char* base = (char*)imagemMapeada;
+    mansao.salas = (Sala*)(base + cabecalho->secoes[SECAO_SALAS].deslocamento);
+    mansao.nomes = (uint32_t*)(base + cabecalho->secoes[SECAO_NOMES_SALAS].deslocamento);
+    ordemSalas = (OrdemSalas)cabecalho->ordemSalas;
+    mansao.quantidade = mansao.capacidade = cabecalho->numSalas;
+    mansao.inicioSaidas = (uint32_t*)(base + cabecalho->secoes[SECAO_INICIO_SAIDAS].deslocamento);
+    mansao.saidas = (uint32_t*)(base + cabecalho->secoes[SECAO_SAIDAS].deslocamento);
+    mansao.numSaidas = cabecalho->numSaidas;
+    
+    strings.texto = base + cabecalho->secoes[SECAO_TEXTO].deslocamento;
+    strings.tamanhoTexto = strings.capacidadeTexto = tamanhoTexto;
+    strings.deslocamentos = (uint32_t*)(base + cabecalho->secoes[SECAO_DESLOCAMENTOS].deslocamento);
+    strings.hashes = (uint64_t*)(base + cabecalho->secoes[SECAO_HASHES].deslocamento);
+    strings.quantidade = strings.capacidade = cabecalho->numStrings;
+    strings.indice = (uint32_t*)(base + cabecalho->secoes[SECAO_INDICE_STRINGS].deslocamento);
+    strings.capacidadeIndice = cabecalho->capacidadeIndiceStrings;
+    
+    tabelaHash.entradas = (HashNode*)(base + cabecalho->secoes[SECAO_ENTRADAS_HASH].deslocamento);
+    tabelaHash.capacidade = cabecalho->capacidadeHash;
+    tabelaHash.ocupadas = cabecalho->ocupadasHash;
+    
+    suspeitos.nomes = (uint32_t*)(base + cabecalho->secoes[SECAO_NOMES_SUSPEITOS].deslocamento);
+    suspeitos.quantidade = suspeitos.capacidade = (int)cabecalho->numSuspeitos;
+    suspeitos.indice = (int*)(base + cabecalho->secoes[SECAO_INDICE_SUSPEITOS].deslocamento);
+    suspeitos.capacidadeIndice = cabecalho->capacidadeIndiceSuspeitos;
+    
+    if (!conteudoValido()) {
+        printf("Erro: a imagem do caso '%s' está corrompida.\n", caminho);
+        exit(1);
+    }
+    return 1;
+}
+
+/*
+ * Função: carregarCaso
+ * Propósito: Carrega o caso a partir de uma imagem compilada, de um arquivo de texto
+ *            ou, sem caminho, da mansão padrão
+ * Parâmetros: caminho - caminho do arquivo do caso (NULL para a mansão padrão)
+ * Retorno: void
+ */
+void carregarCaso(const char* caminho) {
+    geracaoCaso++;
+    if (caminho != NULL && mapearImagem(caminho)) {
+        return;
+    }
+    
+    FILE* arquivo = caminho != NULL ? fopen(caminho, "r")
+                                    : fmemopen((void*)CASO_PADRAO, strlen(CASO_PADRAO), "r");
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível abrir o arquivo de caso '%s'.\n", caminho != NULL ? caminho : "padrão");
+        exit(1);
+    }
+    
+    inicializarTabelaStrings();
+    inicializarTabelaHash();
+    carregarMansao(arquivo, &mansao);
+    fclose(arquivo);
+    reordenarMansao(ordemSalas);
+}
+
+/*
+ * Função: liberarCaso
+ * Propósito: Libera as estruturas do caso (desfaz o mapeamento se vieram de uma imagem)
+ * Parâmetros: void
+ * Retorno: void
+ */
+void liberarCaso() {
+    liberarResumos();
+    liberarRotas();
+    
+    if (imagemMapeada != NULL) {
+        munmap(imagemMapeada, tamanhoImagem);
+        imagemMapeada = NULL;
+        memset(&mansao, 0, sizeof(mansao));
+        memset(&strings, 0, sizeof(strings));
+        memset(&tabelaHash, 0, sizeof(tabelaHash));
+        memset(&suspeitos, 0, sizeof(suspeitos));
+        return;
+    }
+    
+    free(mansao.salas);
+    free(mansao.nomes);
+    free(mansao.inicioSaidas);
+    free(mansao.saidas);
+    memset(&mansao, 0, sizeof(mansao));
+    liberarMemoriaHash();
+    liberarMemoriaSuspeitos();
+    liberarMemoriaStrings();
+}
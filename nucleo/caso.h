@@ -0,0 +1,68 @@
+#ifndef NUCLEO_CASO_H
+#define NUCLEO_CASO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mansao.h"
+
+#define MAGICO_IMAGEM "DQCASO\r\n"        // Assinatura da imagem compilada (8 bytes)
+#define VERSAO_IMAGEM 3                  // Versão do formato da imagem compilada
+#define MARCADOR_ORDEM 0x01020304u       // Detecta imagens geradas com outra ordem de bytes
+#define ALINHAMENTO_SECAO 64             // Seções da imagem começam em linhas de cache
+
+// Seções da imagem compilada do caso
+enum {
+    SECAO_SALAS,                  // Sala[numSalas]
+    SECAO_NOMES_SALAS,            // uint32_t[numSalas]
+    SECAO_TEXTO,                  // char[tamanhoTexto]
+    SECAO_DESLOCAMENTOS,          // uint32_t[numStrings]
+    SECAO_HASHES,                 // uint64_t[numStrings]
+    SECAO_INDICE_STRINGS,         // uint32_t[capacidadeIndiceStrings]
+    SECAO_ENTRADAS_HASH,          // HashNode[capacidadeHash]
+    SECAO_NOMES_SUSPEITOS,        // uint32_t[numSuspeitos]
+    SECAO_INDICE_SUSPEITOS,       // int[capacidadeIndiceSuspeitos]
+    SECAO_INICIO_SAIDAS,          // uint32_t[numSalas + 1]
+    SECAO_SAIDAS,                 // uint32_t[numSaidas]
+    NUM_SECOES
+};
+
+// Posição de uma seção dentro do arquivo de imagem
+typedef struct SecaoImagem {
+    uint64_t deslocamento;        // Início da seção (múltiplo de ALINHAMENTO_SECAO)
+    uint64_t tamanho;             // Tamanho da seção em bytes
+} SecaoImagem;
+
+// Cabeçalho da imagem compilada: tudo o que vem depois são vetores sem ponteiros
+typedef struct CabecalhoImagem {
+    char magico[8];               // MAGICO_IMAGEM
+    uint32_t versao;              // VERSAO_IMAGEM
+    uint32_t marcadorOrdem;       // MARCADOR_ORDEM na ordem de bytes de quem compilou
+    uint32_t numSalas;
+    uint32_t numStrings;
+    uint32_t capacidadeIndiceStrings;
+    uint32_t capacidadeHash;
+    uint32_t ocupadasHash;
+    uint32_t numSuspeitos;
+    uint32_t capacidadeIndiceSuspeitos;
+    uint32_t ordemSalas;          // OrdemSalas usada ao compilar
+    uint32_t numSaidas;
+    uint32_t reservado;           // Zero (alinha as seções a 8 bytes)
+    SecaoImagem secoes[NUM_SECOES];
+} CabecalhoImagem;
+
+extern void* imagemMapeada;
+extern size_t tamanhoImagem;
+extern uint32_t geracaoCaso;
+
+int escreverSecao(FILE* arquivo, const void* dados, uint64_t tamanho);
+int compilarCaso(const char* caminho);
+int secaoValida(const CabecalhoImagem* cabecalho, int secao, uint64_t esperado);
+int potenciaDeDois(uint32_t valor);
+int arvoresValidas();
+int conteudoValido();
+int mapearImagem(const char* caminho);
+void carregarCaso(const char* caminho);
+void liberarCaso();
+
+#endif
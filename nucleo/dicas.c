@@ -0,0 +1,321 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dicas.h"
+#include "suspeitos.h"
+#include "caso.h"
+
+ResumosSubarvore resumos;        // Derivados do caso; preparados no primeiro pedido de dica
+atomic_uint geracaoResumos;      // Geração do caso para a qual "resumos" foi preparado (0 = nenhuma)
+pthread_mutex_t travaResumos = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Função: contarNoIntervalo
+ * Propósito: Conta quantas posições de uma lista crescente caem em [inicio, fim)
+ * Parâmetros: posicoes - lista crescente de posições
+ *            quantidade - tamanho da lista
+ *            inicio, fim - intervalo de posições da pré-ordem
+ * Retorno: número de posições no intervalo
+ */
+uint32_t contarNoIntervalo(const uint32_t* posicoes, uint32_t quantidade, uint32_t inicio, uint32_t fim) {
+    // Duas buscas binárias pelo primeiro elemento >= limite
+    uint32_t limites[2] = {inicio, fim};
+    uint32_t indices[2];
+    for (int i = 0; i < 2; i++) {
+        uint32_t baixo = 0, alto = quantidade;
+        while (baixo < alto) {
+            uint32_t meio = baixo + (alto - baixo) / 2;
+            if (posicoes[meio] < limites[i]) {
+                baixo = meio + 1;
+            } else {
+                alto = meio;
+            }
+        }
+        indices[i] = baixo;
+    }
+    return indices[1] - indices[0];
+}
+
+/*
+ * Função: outraPistaNaSubarvore
+ * Propósito: Verifica se um intervalo da pré-ordem tem alguma pista contra o suspeito
+ *            diferente de uma pista já conhecida
+ * Parâmetros: suspeito - identificador do suspeito
+ *            pistaConhecida - pista que não conta (STRING_VAZIA para aceitar qualquer uma)
+ *            inicio, fim - intervalo de posições da pré-ordem
+ * Retorno: 1 se existe outra pista contra o suspeito no intervalo, 0 caso contrário
+ */
+int outraPistaNaSubarvore(int suspeito, uint32_t pistaConhecida, uint32_t inicio, uint32_t fim) {
+    uint32_t base = resumos.inicioSuspeito[suspeito];
+    uint32_t doSuspeito = contarNoIntervalo(resumos.posicoesSuspeito + base,
+                                            resumos.inicioSuspeito[suspeito + 1] - base, inicio, fim);
+    if (pistaConhecida == STRING_VAZIA) {
+        return doSuspeito > 0;
+    }
+    
+    base = resumos.inicioPista[pistaConhecida];
+    uint32_t daPista = contarNoIntervalo(resumos.posicoesPista + base,
+                                         resumos.inicioPista[pistaConhecida + 1] - base, inicio, fim);
+    return doSuspeito > daPista;
+}
+
+/*
+ * Função: prepararResumos
+ * Propósito: Calcula uma única vez (de baixo para cima) os resumos de suspeitos de cada
+ *            subárvore usados pelas dicas; chamada por garantirResumos
+ * Parâmetros: void
+ * Retorno: void
+ */
+void prepararResumos() {
+    uint32_t n = mansao.quantidade;
+    uint32_t* ordem = (uint32_t*)malloc(n * sizeof(uint32_t));
+    int* suspeitoDaPosicao = (int*)malloc(n * sizeof(int));
+    resumos.entrada = (uint32_t*)malloc(n * sizeof(uint32_t));
+    resumos.tamanho = (uint32_t*)malloc(n * sizeof(uint32_t));
+    resumos.incriminavel = (int*)malloc(n * sizeof(int));
+    resumos.inicioSuspeito = (uint32_t*)calloc(suspeitos.quantidade + 1, sizeof(uint32_t));
+    resumos.inicioPista = (uint32_t*)calloc(strings.quantidade + 1, sizeof(uint32_t));
+    if (ordem == NULL || suspeitoDaPosicao == NULL || resumos.entrada == NULL || resumos.tamanho == NULL
+        || resumos.incriminavel == NULL || resumos.inicioSuspeito == NULL || resumos.inicioPista == NULL) {
+        printf("Erro: Não foi possível alocar memória para os resumos das subárvores.\n");
+        exit(1);
+    }
+    memset(resumos.entrada, 0xff, n * sizeof(uint32_t));
+    
+    // Pré-ordem iterativa (esquerda antes da direita) de cada árvore de ligações "L": a da
+    // entrada e as de salas sem pai, que as passagens alcançam; "ordem" serve de pilha
+    uint8_t* ehFilha = (uint8_t*)calloc(n, 1);
+    if (ehFilha == NULL) {
+        printf("Erro: Não foi possível alocar memória para os resumos das subárvores.\n");
+        exit(1);
+    }
+    for (uint32_t id = 0; id < n; id++) {
+        if (mansao.salas[id].esquerda != SEM_SALA) {
+            ehFilha[mansao.salas[id].esquerda] = 1;
+        }
+        if (mansao.salas[id].direita != SEM_SALA) {
+            ehFilha[mansao.salas[id].direita] = 1;
+        }
+    }
+    uint32_t visitadas = 0;
+    uint32_t* pilha = resumos.tamanho; // Reaproveitado antes de receber os tamanhos
+    for (uint32_t raiz = 0; raiz < n; raiz++) {
+        if (ehFilha[raiz]) {
+            continue;
+        }
+        uint32_t topo = 0;
+        pilha[topo++] = raiz;
+        while (topo > 0) {
+            uint32_t id = pilha[--topo];
+            const Sala* sala = &mansao.salas[id];
+            resumos.entrada[id] = visitadas;
+            ordem[visitadas++] = id;
+            prefetcharSala(sala->esquerda);
+            prefetcharSala(sala->direita);
+            if (sala->direita != SEM_SALA) {
+                pilha[topo++] = sala->direita;
+            }
+            if (sala->esquerda != SEM_SALA) {
+                pilha[topo++] = sala->esquerda;
+            }
+        }
+    }
+    free(ehFilha);
+    
+    // Contagem de salas por suspeito e por pista (vetores CSR em ordem de posição)
+    uint32_t comPista = 0;
+    uint32_t* pistaDaPosicao = (uint32_t*)malloc((size_t)visitadas * sizeof(uint32_t));
+    if (pistaDaPosicao == NULL) {
+        printf("Erro: Não foi possível alocar memória para os resumos das subárvores.\n");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < visitadas; i++) {
+        pistaDaPosicao[i] = mansao.salas[ordem[i]].pista;
+    }
+    buscarSuspeitosEmLote(pistaDaPosicao, visitadas, suspeitoDaPosicao);
+    for (uint32_t i = 0; i < visitadas; i++) {
+        if (suspeitoDaPosicao[i] >= 0) {
+            resumos.inicioSuspeito[suspeitoDaPosicao[i]]++;
+            resumos.inicioPista[pistaDaPosicao[i]]++;
+            comPista++;
+        }
+    }
+    free(pistaDaPosicao);
+    for (uint32_t i = 0, soma = 0; i <= (uint32_t)suspeitos.quantidade; i++) {
+        uint32_t quantidade = resumos.inicioSuspeito[i];
+        resumos.inicioSuspeito[i] = soma;
+        soma += quantidade;
+    }
+    for (uint32_t i = 0, soma = 0; i <= strings.quantidade; i++) {
+        uint32_t quantidade = resumos.inicioPista[i];
+        resumos.inicioPista[i] = soma;
+        soma += quantidade;
+    }
+    resumos.posicoesSuspeito = (uint32_t*)malloc((comPista + 1) * sizeof(uint32_t));
+    resumos.posicoesPista = (uint32_t*)malloc((comPista + 1) * sizeof(uint32_t));
+    uint32_t* proximoSuspeito = (uint32_t*)malloc((suspeitos.quantidade + 1) * sizeof(uint32_t));
+    uint32_t* proximaPista = (uint32_t*)malloc((strings.quantidade + 1) * sizeof(uint32_t));
+    if (resumos.posicoesSuspeito == NULL || resumos.posicoesPista == NULL
+        || proximoSuspeito == NULL || proximaPista == NULL) {
+        printf("Erro: Não foi possível alocar memória para os resumos das subárvores.\n");
+        exit(1);
+    }
+    memcpy(proximoSuspeito, resumos.inicioSuspeito, (suspeitos.quantidade + 1) * sizeof(uint32_t));
+    memcpy(proximaPista, resumos.inicioPista, (strings.quantidade + 1) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < visitadas; i++) {
+        if (suspeitoDaPosicao[i] >= 0) {
+            resumos.posicoesSuspeito[proximoSuspeito[suspeitoDaPosicao[i]]++] = i;
+            resumos.posicoesPista[proximaPista[mansao.salas[ordem[i]].pista]++] = i;
+        }
+    }
+    free(proximoSuspeito);
+    free(proximaPista);
+    
+    // De baixo para cima (pré-ordem invertida: filhos antes do pai)
+    for (uint32_t i = visitadas; i-- > 0; ) {
+        uint32_t id = ordem[i];
+        const Sala* sala = &mansao.salas[id];
+        uint32_t tamanho = 1;
+        int incriminavel = -1;
+        
+        // Um caminho de algum filho já incrimina alguém sozinho
+        if (sala->esquerda != SEM_SALA) {
+            tamanho += resumos.tamanho[sala->esquerda];
+            incriminavel = resumos.incriminavel[sala->esquerda];
+        }
+        if (sala->direita != SEM_SALA) {
+            tamanho += resumos.tamanho[sala->direita];
+            if (incriminavel < 0) {
+                incriminavel = resumos.incriminavel[sala->direita];
+            }
+        }
+        
+        // Ou a pista desta sala é completada por outra pista do mesmo suspeito abaixo dela
+        if (incriminavel < 0 && suspeitoDaPosicao[i] >= 0
+            && outraPistaNaSubarvore(suspeitoDaPosicao[i], sala->pista, i + 1, i + tamanho)) {
+            incriminavel = suspeitoDaPosicao[i];
+        }
+        resumos.tamanho[id] = tamanho;
+        resumos.incriminavel[id] = incriminavel;
+    }
+    
+    free(ordem);
+    free(suspeitoDaPosicao);
+}
+
+/*
+ * Função: garantirResumos
+ * Propósito: Prepara os resumos do caso carregado, se ainda não foram preparados para ele
+ *            (um novo carregarCaso muda a geração); depois disso é só uma leitura atômica
+ * Parâmetros: void
+ * Retorno: void
+ */
+void garantirResumos() {
+    if (atomic_load_explicit(&geracaoResumos, memory_order_acquire) == geracaoCaso) {
+        return;
+    }
+    
+    pthread_mutex_lock(&travaResumos);
+    if (atomic_load_explicit(&geracaoResumos, memory_order_relaxed) != geracaoCaso) {
+        prepararResumos();
+        atomic_store_explicit(&geracaoResumos, geracaoCaso, memory_order_release);
+    }
+    pthread_mutex_unlock(&travaResumos);
+}
+
+/*
+ * Função: avaliarRamo
+ * Propósito: Descobre se seguir por uma sala ainda permite incriminar alguém, dadas as
+ *            pistas já coletadas (O(suspeitos com uma pista * log n), sem explorar a
+ *            subárvore); entre vários, vale o de pista coletada menor em ordem alfabética
+ * Parâmetros: sessao - investigação em andamento
+ *            id - sala para onde o jogador pode ir
+ * Retorno: suspeito que ainda pode ser incriminado por esse ramo (-1 se nenhum)
+ */
+int avaliarRamo(Sessao* sessao, uint32_t id) {
+    // Dois caminhos de pistas novas na própria subárvore
+    if (resumos.incriminavel[id] >= 0) {
+        return resumos.incriminavel[id];
+    }
+    
+    // Ou uma pista nova que completa um suspeito com exatamente uma pista coletada
+    uint32_t inicio = resumos.entrada[id];
+    uint32_t fim = inicio + resumos.tamanho[id];
+    int escolhido = -1;
+    for (int i = 0; i < sessao->numComUmaPista; i++) {
+        int suspeito = sessao->comUmaPista[i];
+        uint32_t pista = sessao->primeiraPista[suspeito];
+        if (outraPistaNaSubarvore(suspeito, pista, inicio, fim)
+            && (escolhido < 0 || strcmp(textoDaString(pista),
+                                        textoDaString(sessao->primeiraPista[escolhido])) < 0)) {
+            escolhido = suspeito;
+        }
+    }
+    return escolhido;
+}
+
+/*
+ * Função: mostrarDica
+ * Propósito: Indica quais saídas da sala ainda podem levar a uma condenação (cada saída
+ *            é avaliada pela árvore de ligações abaixo dela; passagens adiante não contam),
+ *            em O(suspeitos com uma pista) por saída
+ * Parâmetros: sessao - investigação em andamento
+ *            idSala - sala onde o jogador está
+ * Retorno: void
+ */
+void mostrarDica(Sessao* sessao, uint32_t idSala) {
+    garantirResumos();
+    mostrar(sessao, "\n💡 DICA:\n");
+    
+    // Se algum suspeito já tem 2 pistas, não é preciso seguir adiante
+    for (int id = 0; id < suspeitos.quantidade; id++) {
+        if (sessao->contagemSuspeitos[id] >= 2) {
+            mostrar(sessao, "   Você já tem pistas suficientes contra %s. Use (s) para acusar!\n",
+                    textoDaString(suspeitos.nomes[id]));
+            return;
+        }
+    }
+    
+    const Sala* salaAtual = &mansao.salas[idSala];
+    const uint32_t* saidas = saidasDaSala(idSala);
+    uint32_t grau = grauSala(idSala);
+    uint32_t saidasDaArvore = (salaAtual->esquerda != SEM_SALA) + (salaAtual->direita != SEM_SALA);
+    for (uint32_t i = 0; i < grau; i++) {
+        char direcao[32];
+        if (i >= saidasDaArvore) {
+            snprintf(direcao, sizeof(direcao), "Passagem %u", i - saidasDaArvore + 1);
+        } else {
+            snprintf(direcao, sizeof(direcao), "%s", saidas[i] == salaAtual->esquerda ? "Esquerda" : "Direita");
+        }
+        int suspeito = avaliarRamo(sessao, saidas[i]);
+        if (suspeito >= 0) {
+            mostrar(sessao, "   %s (%s): ainda pode incriminar %s\n", direcao,
+                    textoDaString(mansao.nomes[saidas[i]]), textoDaString(suspeitos.nomes[suspeito]));
+        } else {
+            mostrar(sessao, "   %s (%s): nenhum suspeito pode ser incriminado por aqui\n", direcao,
+                    textoDaString(mansao.nomes[saidas[i]]));
+        }
+    }
+    if (grau == 0) {
+        mostrar(sessao, "   Não há mais saídas: faça seu julgamento com as pistas que tem.\n");
+    }
+}
+
+/*
+ * Função: liberarResumos
+ * Propósito: Libera os resumos das dicas (só existem se alguma dica foi pedida)
+ * Parâmetros: void
+ * Retorno: void
+ */
+void liberarResumos() {
+    free(resumos.entrada);
+    free(resumos.tamanho);
+    free(resumos.incriminavel);
+    free(resumos.inicioSuspeito);
+    free(resumos.posicoesSuspeito);
+    free(resumos.inicioPista);
+    free(resumos.posicoesPista);
+    memset(&resumos, 0, sizeof(resumos));
+    atomic_store_explicit(&geracaoResumos, 0, memory_order_relaxed);
+}
@@ -0,0 +1,36 @@
+#ifndef NUCLEO_DICAS_H
+#define NUCLEO_DICAS_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "sessao.h"
+
+// Resumos por subárvore para as dicas: como a condição de vitória é 2 pistas, basta saber
+// qual suspeito um único caminho da subárvore incrimina sozinho e, para completar uma pista
+// já coletada, quantas salas de cada suspeito/pista existem na subárvore. Em pré-ordem cada
+// subárvore é um intervalo contíguo, então essas contagens são duas buscas binárias.
+typedef struct ResumosSubarvore {
+    uint32_t* entrada;            // Posição da sala na pré-ordem das árvores de ligações
+    uint32_t* tamanho;            // Salas da subárvore: ocupa [entrada, entrada + tamanho)
+    int* incriminavel;            // Suspeito com 2 pistas em um caminho da subárvore (-1 se nenhum)
+    uint32_t* inicioSuspeito;     // Início das posições de cada suspeito em posicoesSuspeito
+    uint32_t* posicoesSuspeito;   // Posições (crescentes) das salas com pista de cada suspeito
+    uint32_t* inicioPista;        // Início das posições de cada pista em posicoesPista
+    uint32_t* posicoesPista;      // Posições (crescentes) das salas com cada pista
+} ResumosSubarvore;
+
+extern ResumosSubarvore resumos;
+extern atomic_uint geracaoResumos;
+extern pthread_mutex_t travaResumos;
+
+uint32_t contarNoIntervalo(const uint32_t* posicoes, uint32_t quantidade, uint32_t inicio, uint32_t fim);
+int outraPistaNaSubarvore(int suspeito, uint32_t pistaConhecida, uint32_t inicio, uint32_t fim);
+void prepararResumos();
+void garantirResumos();
+int avaliarRamo(Sessao* sessao, uint32_t id);
+void mostrarDica(Sessao* sessao, uint32_t idSala);
+void liberarResumos();
+
+#endif
@@ -0,0 +1,139 @@
+#define _POSIX_C_SOURCE 200809L  // sigwait e clock_gettime
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+
+#include "instrumentacao.h"
+
+#ifdef INSTRUMENTACAO
+const char* nomesMetricas[NUM_METRICAS] = {
+    "sessoes", "visitas", "nsVisitas", "insercoes", "nsInsercoes", "profundidadeTotal",
+    "profundidadeMaxima", "buscasPistas", "buscasSemSucesso", "sondagensPistas",
+    "sondagemMaximaPistas", "buscasStrings", "sondagensStrings", "sondagemMaximaStrings",
+    "atualizacoesContadores", "nsAtualizacoes", "relatorios", "nsRelatorios"
+};
+const char* nomesHistogramas[NUM_HISTOGRAMAS] = {
+    "profundidadeInsercoes", "sondagensPistas", "sondagensStrings"
+};
+
+Instrumentacao* instrumentacoes = NULL;  // Métricas de todas as threads que já registraram algo
+pthread_mutex_t travaInstrumentacao = PTHREAD_MUTEX_INITIALIZER;
+_Thread_local Instrumentacao* instrumentacaoLocal = NULL;
+
+/*
+ * Função: escreverMetricas
+ * Propósito: Soma as métricas de todas as threads e as escreve como um objeto JSON em uma linha
+ * Parâmetros: destino - arquivo de saída
+ * Retorno: void
+ */
+void escreverMetricas(FILE* destino) {
+    uint64_t valores[NUM_METRICAS] = {0};
+    uint64_t faixas[NUM_HISTOGRAMAS][FAIXAS_HISTOGRAMA] = {{0}};
+    int threads = 0;
+    
+    pthread_mutex_lock(&travaInstrumentacao);
+    for (Instrumentacao* inst = instrumentacoes; inst != NULL; inst = inst->proxima, threads++) {
+        for (int m = 0; m < NUM_METRICAS; m++) {
+            uint64_t valor = atomic_load_explicit(&inst->valores[m], memory_order_relaxed);
+            int maximo = m == METRICA_PROFUNDIDADE_MAXIMA || m == METRICA_SONDAGEM_MAXIMA_PISTAS
+                         || m == METRICA_SONDAGEM_MAXIMA_STRINGS;
+            valores[m] = maximo ? (valor > valores[m] ? valor : valores[m]) : valores[m] + valor;
+        }
+        for (int h = 0; h < NUM_HISTOGRAMAS; h++) {
+            for (int f = 0; f < FAIXAS_HISTOGRAMA; f++) {
+                faixas[h][f] += atomic_load_explicit(&inst->faixas[h][f], memory_order_relaxed);
+            }
+        }
+    }
+    
+    fprintf(destino, "{\"threads\": %d", threads);
+    for (int m = 0; m < NUM_METRICAS; m++) {
+        fprintf(destino, ", \"%s\": %llu", nomesMetricas[m], (unsigned long long)valores[m]);
+    }
+    fprintf(destino, ", \"histogramas\": {");
+    for (int h = 0; h < NUM_HISTOGRAMAS; h++) {
+        fprintf(destino, "%s\"%s\": [", h > 0 ? ", " : "", nomesHistogramas[h]);
+        for (int f = 0; f < FAIXAS_HISTOGRAMA; f++) {
+            fprintf(destino, "%s%llu", f > 0 ? ", " : "", (unsigned long long)faixas[h][f]);
+        }
+        fprintf(destino, "]");
+    }
+    fprintf(destino, "}}\n");
+    fflush(destino);
+    pthread_mutex_unlock(&travaInstrumentacao);
+}
+
+FILE* destinoMetricas = NULL;
+
+/*
+ * Função: despejarAoSair
+ * Propósito: Escreve o relatório final de métricas (registrada com atexit)
+ * Parâmetros: void
+ * Retorno: void
+ */
+void despejarAoSair() {
+    escreverMetricas(destinoMetricas);
+    if (destinoMetricas != stderr) {
+        fclose(destinoMetricas);
+    }
+}
+
+/*
+ * Função: atenderSinalMetricas
+ * Propósito: Thread que escreve um relatório parcial a cada SIGUSR1 recebido
+ * Parâmetros: argumento - não utilizado
+ * Retorno: NULL (nunca retorna)
+ */
+void* atenderSinalMetricas(void* argumento) {
+    (void)argumento;
+    sigset_t sinais;
+    sigemptyset(&sinais);
+    sigaddset(&sinais, SIGUSR1);
+    for (;;) {
+        int sinal;
+        if (sigwait(&sinais, &sinal) == 0) {
+            escreverMetricas(destinoMetricas);
+        }
+    }
+    return NULL;
+}
+#endif
+
+/*
+ * Função: iniciarInstrumentacao
+ * Propósito: Abre o destino das métricas (--metricas), agenda o relatório final e
+ *            passa a atender SIGUSR1 (deve ser chamada antes de criar outras threads,
+ *            que herdam o sinal bloqueado)
+ * Parâmetros: arquivo - destino do relatório ("-" para stderr; NULL = sem relatório)
+ * Retorno: void
+ */
+void iniciarInstrumentacao(const char* arquivo) {
+    if (arquivo == NULL) {
+        return;
+    }
+#ifdef INSTRUMENTACAO
+    destinoMetricas = strcmp(arquivo, "-") == 0 ? stderr : fopen(arquivo, "w");
+    if (destinoMetricas == NULL) {
+        printf("Erro: Não foi possível criar o arquivo de métricas '%s'.\n", arquivo);
+        exit(1);
+    }
+    atexit(despejarAoSair);
+    
+    sigset_t sinais;
+    sigemptyset(&sinais);
+    sigaddset(&sinais, SIGUSR1);
+    pthread_t atendente;
+    if (pthread_sigmask(SIG_BLOCK, &sinais, NULL) != 0
+        || pthread_create(&atendente, NULL, atenderSinalMetricas, NULL) != 0) {
+        printf("Erro: Não foi possível preparar o relatório de métricas.\n");
+        exit(1);
+    }
+    pthread_detach(atendente);
+#else
+    printf("Erro: --metricas requer o jogo compilado com -DINSTRUMENTACAO.\n");
+    exit(1);
+#endif
+}
@@ -0,0 +1,192 @@
+#ifndef NUCLEO_INSTRUMENTACAO_H
+#define NUCLEO_INSTRUMENTACAO_H
+
+#include <stdio.h>
+
+// Instrumentação dos caminhos quentes: só existe quando compilada com -DINSTRUMENTACAO;
+// sem ela, INSTRUMENTAR(...) não gera código algum
+#ifdef INSTRUMENTACAO
+#define INSTRUMENTAR(...) __VA_ARGS__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+#define FAIXAS_HISTOGRAMA 16             // Faixas em potências de 2: 1, 2-3, 4-7, ..., 2^15+
+
+// Contadores e tempos acumulados (os máximos são combinados pelo maior valor)
+typedef enum Metrica {
+    METRICA_SESSOES,
+    METRICA_VISITAS,              // Salas visitadas
+    METRICA_NS_VISITAS,           // Processamento das visitas (sem a espera pela jogada)
+    METRICA_INSERCOES,            // Pistas inseridas no inventário (inclusive repetidas)
+    METRICA_NS_INSERCOES,
+    METRICA_PROFUNDIDADE_TOTAL,   // Soma das profundidades de inserção na árvore AVL
+    METRICA_PROFUNDIDADE_MAXIMA,
+    METRICA_BUSCAS_PISTAS,        // Consultas à tabela pista -> suspeito
+    METRICA_BUSCAS_SEM_SUCESSO,
+    METRICA_SONDAGENS_PISTAS,     // Posições examinadas nessas consultas
+    METRICA_SONDAGEM_MAXIMA_PISTAS,
+    METRICA_BUSCAS_STRINGS,       // Consultas ao índice de strings (texto -> identificador)
+    METRICA_SONDAGENS_STRINGS,
+    METRICA_SONDAGEM_MAXIMA_STRINGS,
+    METRICA_ATUALIZACOES,         // Incrementos nos contadores de suspeitos
+    METRICA_NS_ATUALIZACOES,
+    METRICA_RELATORIOS,           // Relatórios do julgamento final (até o pedido de acusação)
+    METRICA_NS_RELATORIOS,
+    NUM_METRICAS
+} Metrica;
+
+// Distribuições registradas por faixa
+typedef enum Histograma {
+    HISTOGRAMA_PROFUNDIDADE,
+    HISTOGRAMA_SONDAGENS_PISTAS,
+    HISTOGRAMA_SONDAGENS_STRINGS,
+    NUM_HISTOGRAMAS
+} Histograma;
+
+// Métricas de uma thread: escritas só por ela (sem instruções atômicas de
+// leitura-modificação-escrita) e lidas por quem gera o relatório
+typedef struct Instrumentacao {
+    _Atomic uint64_t valores[NUM_METRICAS];
+    _Atomic uint64_t faixas[NUM_HISTOGRAMAS][FAIXAS_HISTOGRAMA];
+    struct Instrumentacao* proxima;
+} Instrumentacao;
+
+
+// Métricas de todas as threads que já registraram algo
+extern Instrumentacao* instrumentacoes;
+extern pthread_mutex_t travaInstrumentacao;
+extern _Thread_local Instrumentacao* instrumentacaoLocal;
+
+/*
+ * Função: instrumentacaoDaThread
+ * Propósito: Obtém as métricas da thread atual, registrando-as no primeiro uso
+ *            (continuam na lista depois que a thread termina)
+ * Parâmetros: void
+ * Retorno: métricas da thread atual
+ */
+static inline Instrumentacao* instrumentacaoDaThread() {
+    if (instrumentacaoLocal == NULL) {
+        Instrumentacao* nova = (Instrumentacao*)calloc(1, sizeof(Instrumentacao));
+        if (nova == NULL) {
+            printf("Erro: Não foi possível alocar memória para a instrumentação.\n");
+            exit(1);
+        }
+        pthread_mutex_lock(&travaInstrumentacao);
+        nova->proxima = instrumentacoes;
+        instrumentacoes = nova;
+        pthread_mutex_unlock(&travaInstrumentacao);
+        instrumentacaoLocal = nova;
+    }
+    return instrumentacaoLocal;
+}
+
+/*
+ * Função: somarMetrica
+ * Propósito: Acumula um valor em uma métrica da thread atual
+ * Parâmetros: metrica - métrica a acumular
+ *            valor - quantidade somada
+ * Retorno: void
+ */
+static inline void somarMetrica(Metrica metrica, uint64_t valor) {
+    _Atomic uint64_t* campo = &instrumentacaoDaThread()->valores[metrica];
+    atomic_store_explicit(campo, atomic_load_explicit(campo, memory_order_relaxed) + valor,
+                          memory_order_relaxed);
+}
+
+/*
+ * Função: registrarMaximo
+ * Propósito: Mantém o maior valor observado em uma métrica da thread atual
+ * Parâmetros: metrica - métrica de máximo
+ *            valor - valor observado
+ * Retorno: void
+ */
+static inline void registrarMaximo(Metrica metrica, uint64_t valor) {
+    _Atomic uint64_t* campo = &instrumentacaoDaThread()->valores[metrica];
+    if (valor > atomic_load_explicit(campo, memory_order_relaxed)) {
+        atomic_store_explicit(campo, valor, memory_order_relaxed);
+    }
+}
+
+/*
+ * Função: registrarNaFaixa
+ * Propósito: Conta um valor na faixa (potência de 2) correspondente de um histograma
+ * Parâmetros: histograma - distribuição a atualizar
+ *            valor - valor observado (>= 1)
+ * Retorno: void
+ */
+static inline void registrarNaFaixa(Histograma histograma, uint64_t valor) {
+    int faixa = 0;
+    while (valor > 1 && faixa < FAIXAS_HISTOGRAMA - 1) {
+        valor >>= 1;
+        faixa++;
+    }
+    _Atomic uint64_t* campo = &instrumentacaoDaThread()->faixas[histograma][faixa];
+    atomic_store_explicit(campo, atomic_load_explicit(campo, memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+}
+
+/*
+ * Função: relogioInstrumentacao
+ * Propósito: Lê o relógio monotônico para os tempos da instrumentação
+ * Parâmetros: void
+ * Retorno: instante atual em nanossegundos
+ */
+static inline uint64_t relogioInstrumentacao() {
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return (uint64_t)instante.tv_sec * 1000000000u + (uint64_t)instante.tv_nsec;
+}
+
+/*
+ * Função: medirDesde
+ * Propósito: Acumula em uma métrica de tempo o intervalo desde um instante
+ * Parâmetros: metrica - métrica de tempo (ns)
+ *            inicio - instante lido por relogioInstrumentacao
+ * Retorno: void
+ */
+static inline void medirDesde(Metrica metrica, uint64_t inicio) {
+    somarMetrica(metrica, relogioInstrumentacao() - inicio);
+}
+
+/*
+ * Função: registrarInsercao
+ * Propósito: Registra uma inserção no inventário e o nível alcançado na árvore AVL
+ * Parâmetros: nivel - nível do nó inserido ou encontrado (raiz = 1)
+ *            inicio - instante do começo da inserção
+ * Retorno: void
+ */
+static inline void registrarInsercao(uint64_t nivel, uint64_t inicio) {
+    somarMetrica(METRICA_INSERCOES, 1);
+    somarMetrica(METRICA_PROFUNDIDADE_TOTAL, nivel);
+    registrarMaximo(METRICA_PROFUNDIDADE_MAXIMA, nivel);
+    registrarNaFaixa(HISTOGRAMA_PROFUNDIDADE, nivel);
+    medirDesde(METRICA_NS_INSERCOES, inicio);
+}
+
+/*
+ * Função: registrarSondagem
+ * Propósito: Registra o comprimento de uma sondagem linear
+ * Parâmetros: metrica - METRICA_SONDAGENS_PISTAS ou METRICA_SONDAGENS_STRINGS
+ *            comprimento - posições examinadas (incluindo a que encerrou a busca)
+ * Retorno: void
+ */
+static inline void registrarSondagem(Metrica metrica, uint64_t comprimento) {
+    int pistas = metrica == METRICA_SONDAGENS_PISTAS;
+    somarMetrica(pistas ? METRICA_BUSCAS_PISTAS : METRICA_BUSCAS_STRINGS, 1);
+    somarMetrica(metrica, comprimento);
+    registrarMaximo(pistas ? METRICA_SONDAGEM_MAXIMA_PISTAS : METRICA_SONDAGEM_MAXIMA_STRINGS, comprimento);
+    registrarNaFaixa(pistas ? HISTOGRAMA_SONDAGENS_PISTAS : HISTOGRAMA_SONDAGENS_STRINGS, comprimento);
+}
+
+void escreverMetricas(FILE* destino);
+#else
+#define INSTRUMENTAR(...)
+#endif
+
+void iniciarInstrumentacao(const char* arquivo);
+
+#endif
@@ -0,0 +1,148 @@
+#define _POSIX_C_SOURCE 200809L  // open_memstream, clock_gettime e sysconf
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "lote.h"
+#include "suspeitos.h"
+
+/*
+ * Função: executarSessoes
+ * Propósito: Laço de uma thread do pool: pega a próxima sessão pendente (contador
+ *            atômico, sem locks) até o lote acabar; o caso é lido sem sincronização
+ * Parâmetros: argumento - lote de sessões (LoteSessoes*)
+ * Retorno: NULL
+ */
+void* executarSessoes(void* argumento) {
+    LoteSessoes* lote = (LoteSessoes*)argumento;
+    
+    for (;;) {
+        int indice = atomic_fetch_add_explicit(&lote->proxima, 1, memory_order_relaxed);
+        if (indice >= lote->quantidade) {
+            return NULL;
+        }
+        
+        // A transcrição de cada sessão vai para um buffer próprio em memória
+        ResultadoSessao* resultado = &lote->resultados[indice];
+        FILE* saida = NULL;
+        if (!lote->silencioso) {
+            saida = open_memstream(&resultado->transcricao, &resultado->tamanhoTranscricao);
+            if (saida == NULL) {
+                printf("Erro: Não foi possível alocar memória para a saída da sessão.\n");
+                exit(1);
+            }
+        }
+        
+        Sessao sessao;
+        iniciarSessao(&sessao, lote->nivel, saida, lote->roteiros[indice]);
+        jogarSessao(&sessao);
+        
+        resultado->pistas = contarPistas(sessao.raizPistas);
+        resultado->acusado = sessao.acusado;
+        resultado->resolvido = sessao.acusado >= 0 && sessao.pistasDoAcusado >= 2;
+        encerrarSessao(&sessao);
+        if (saida != NULL) {
+            fclose(saida);
+        }
+    }
+}
+
+/*
+ * Função: executarLoteSessoes
+ * Propósito: Executa em paralelo uma sessão por linha do roteiro carregado e exibe
+ *            as transcrições (na ordem do roteiro) e um resumo do lote
+ * Parâmetros: nivel - nível jogado em todas as sessões
+ *            roteiros - roteiro carregado, uma sessão por linha (as quebras de linha
+ *                       viram '\0')
+ *            threads - tamanho do pool (0 = uma por núcleo)
+ *            silencioso - 1 para exibir só o resumo
+ * Retorno: void
+ */
+void executarLoteSessoes(const Nivel* nivel, char* roteiros, int threads, int silencioso) {
+    // Cada linha não vazia do roteiro é uma sessão independente
+    LoteSessoes lote;
+    int capacidade = 0;
+    lote.nivel = nivel;
+    lote.silencioso = silencioso;
+    lote.roteiros = NULL;
+    lote.quantidade = 0;
+    atomic_init(&lote.proxima, 0);
+    for (char* linha = roteiros; linha != NULL && *linha != '\0'; ) {
+        char* fim = strchr(linha, '\n');
+        if (fim != NULL) {
+            *fim = '\0';
+        }
+        if (linha[strspn(linha, " \t\r")] != '\0' && linha[strspn(linha, " \t\r")] != '#') {
+            if (lote.quantidade == capacidade) {
+                capacidade = capacidade > 0 ? capacidade * 2 : CAPACIDADE_ROTEIROS_INICIAL;
+                char** novosRoteiros = (char**)realloc(lote.roteiros, capacidade * sizeof(char*));
+                if (novosRoteiros == NULL) {
+                    printf("Erro: Não foi possível alocar memória para as sessões.\n");
+                    exit(1);
+                }
+                lote.roteiros = novosRoteiros;
+            }
+            lote.roteiros[lote.quantidade++] = linha;
+        }
+        linha = fim != NULL ? fim + 1 : NULL;
+    }
+    
+    lote.resultados = (ResultadoSessao*)calloc(lote.quantidade + 1, sizeof(ResultadoSessao));
+    if (threads <= 0) {
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (threads > lote.quantidade) {
+        threads = lote.quantidade > 0 ? lote.quantidade : 1;
+    }
+    pthread_t* pool = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    if (lote.resultados == NULL || pool == NULL) {
+        printf("Erro: Não foi possível alocar memória para as sessões.\n");
+        exit(1);
+    }
+    
+    struct timespec inicio, fim;
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&pool[i], NULL, executarSessoes, &lote) != 0) {
+            printf("Erro: Não foi possível criar as threads das sessões.\n");
+            exit(1);
+        }
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(pool[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    double segundos = (fim.tv_sec - inicio.tv_sec) + (fim.tv_nsec - inicio.tv_nsec) / 1e9;
+    
+    // Transcrições na ordem do roteiro, seguidas do resumo
+    int resolvidas = 0;
+    long totalPistas = 0;
+    for (int i = 0; i < lote.quantidade; i++) {
+        ResultadoSessao* resultado = &lote.resultados[i];
+        if (resultado->transcricao != NULL) {
+            printf("\n############ SESSÃO %d ############\n", i + 1);
+            fwrite(resultado->transcricao, 1, resultado->tamanhoTranscricao, stdout);
+            free(resultado->transcricao);
+        }
+        resolvidas += resultado->resolvido;
+        totalPistas += resultado->pistas;
+    }
+    printf("\n========================================\n");
+    printf("RESUMO DO LOTE DE SESSÕES\n");
+    printf("========================================\n");
+    printf("Sessões: %d (%d thread%s)\n", lote.quantidade, threads, threads == 1 ? "" : "s");
+    printf("Casos resolvidos: %d\n", resolvidas);
+    printf("Pistas coletadas: %ld\n", totalPistas);
+    printf("Tempo: %.3f s (%.0f sessões/s)\n", segundos, segundos > 0 ? lote.quantidade / segundos : 0.0);
+    
+    free(pool);
+    free(lote.resultados);
+    free(lote.roteiros);
+}
@@ -0,0 +1,33 @@
+#ifndef NUCLEO_LOTE_H
+#define NUCLEO_LOTE_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "sessao.h"
+
+#define CAPACIDADE_ROTEIROS_INICIAL 16  // Capacidade inicial do vetor de roteiros das sessões
+
+// Resultado de uma sessão executada pelo pool de threads
+typedef struct ResultadoSessao {
+    int pistas;                   // Total de pistas coletadas
+    int acusado;                  // Suspeito acusado (-1 se nenhum)
+    int resolvido;                // 1 se a acusação foi sustentada
+    char* transcricao;            // Saída completa da sessão (NULL no modo silencioso)
+    size_t tamanhoTranscricao;
+} ResultadoSessao;
+
+// Lote de sessões distribuído entre as threads sem locks (contador atômico)
+typedef struct LoteSessoes {
+    const Nivel* nivel;           // Nível jogado por todas as sessões
+    int silencioso;               // 1 = sem transcrições (só o resumo)
+    char** roteiros;              // Roteiro de cada sessão
+    ResultadoSessao* resultados;  // Resultado de cada sessão (escrito uma única vez)
+    int quantidade;               // Número de sessões
+    atomic_int proxima;           // Próxima sessão ainda não iniciada
+} LoteSessoes;
+
+void* executarSessoes(void* argumento);
+void executarLoteSessoes(const Nivel* nivel, char* roteiros, int threads, int silencioso);
+
+#endif
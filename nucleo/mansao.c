@@ -0,0 +1,649 @@
+#define _POSIX_C_SOURCE 200809L  // getline
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mansao.h"
+#include "suspeitos.h"
+
+// Mansão padrão, usada quando nenhum arquivo de caso é informado
+// Formato (campos separados por TAB): S id nome pista | L id esquerda direita | C id destino |
+// P pista suspeito
+const char* CASO_PADRAO =
+    "# Mansão padrão do Detective Quest\n"
+    "S\t0\tHall de Entrada\tMapa da mansão encontrado\n"
+    "S\t1\tSala de Estar\tPegadas suspeitas no tapete\n"
+    "S\t2\tBiblioteca\tLivro com páginas rasgadas\n"
+    "S\t3\tCozinha\tFaca com manchas estranhas\n"
+    "S\t4\tQuarto Principal\tCarta misteriosa na gaveta\n"
+    "S\t5\tEscritório\tDocumento confidencial\n"
+    "S\t6\tJardim\tChave enterrada no solo\n"
+    "S\t7\tDespensa\t\n"
+    "S\t8\tBanheiro\tFrasco de remédio vazio\n"
+    "S\t9\tCloset\tJoia valiosa escondida\n"
+    "S\t10\tVaranda\t\n"
+    "L\t0\t1\t2\n"
+    "L\t1\t3\t4\n"
+    "L\t2\t5\t6\n"
+    "L\t3\t7\t8\n"
+    "L\t4\t9\t10\n"
+    "P\tMapa da mansão encontrado\tMordomo\n"
+    "P\tPegadas suspeitas no tapete\tJardineiro\n"
+    "P\tLivro com páginas rasgadas\tBibliotecária\n"
+    "P\tFaca com manchas estranhas\tCozinheiro\n"
+    "P\tCarta misteriosa na gaveta\tMordomo\n"
+    "P\tDocumento confidencial\tSecretária\n"
+    "P\tChave enterrada no solo\tJardineiro\n"
+    "P\tFrasco de remédio vazio\tEnfermeira\n"
+    "P\tJoia valiosa escondida\tCozinheiro\n";
+
+// Mansão do caso carregado
+Mansao mansao = {NULL, NULL, NULL, 0, 0, NULL, NULL, 0, NULL, 0, 0};
+OrdemSalas ordemSalas = ORDEM_ARQUIVO; // Ordem pedida na linha de comando (--ordem)
+
+/*
+ * Função: erroCaso
+ * Propósito: Informa um erro de formato no arquivo de caso e encerra o programa
+ * Parâmetros: numeroLinha - linha onde o erro foi encontrado
+ *            mensagem - descrição do problema
+ * Retorno: não retorna
+ */
+void erroCaso(long numeroLinha, const char* mensagem) {
+    printf("Erro: linha %ld do arquivo de caso: %s.\n", numeroLinha, mensagem);
+    exit(1);
+}
+
+/*
+ * Função: separarCampos
+ * Propósito: Divide uma linha em campos separados por TAB (campos vazios são preservados)
+ * Parâmetros: linha - linha lida (é modificada: separadores viram '\0')
+ *            campos - vetor de saída com o início de cada campo
+ * Retorno: quantidade de campos encontrados (no máximo MAX_CAMPOS_CASO)
+ */
+int separarCampos(char* linha, char* campos[MAX_CAMPOS_CASO]) {
+    // Remove a quebra de linha (inclusive de arquivos gerados no Windows)
+    linha[strcspn(linha, "\r\n")] = '\0';
+    
+    int quantidade = 0;
+    char* inicio = linha;
+    while (quantidade < MAX_CAMPOS_CASO) {
+        campos[quantidade++] = inicio;
+        char* separador = strchr(inicio, '\t');
+        if (separador == NULL) {
+            break;
+        }
+        *separador = '\0';
+        inicio = separador + 1;
+    }
+    return quantidade;
+}
+
+/*
+ * Função: lerIdSala
+ * Propósito: Converte o campo de identificador de sala de uma linha do caso
+ * Parâmetros: campo - texto do campo ("-" indica ausência de sala)
+ *            numeroLinha - linha atual (para mensagens de erro)
+ * Retorno: identificador da sala ou SEM_SALA para "-"
+ */
+uint32_t lerIdSala(const char* campo, long numeroLinha) {
+    if (strcmp(campo, "-") == 0) {
+        return SEM_SALA;
+    }
+    
+    char* fim;
+    unsigned long id = strtoul(campo, &fim, 10);
+    if (fim == campo || *fim != '\0' || id >= SEM_SALA) {
+        erroCaso(numeroLinha, "identificador de sala inválido");
+    }
+    // Os vetores crescem até o maior identificador: um número solto muito além das linhas
+    // lidas alocaria gigabytes para salas que o arquivo não tem como definir
+    if (id > 2 * (unsigned long)numeroLinha + FOLGA_IDS_SALA) {
+        erroCaso(numeroLinha, "identificador de sala muito além das salas do arquivo");
+    }
+    return (uint32_t)id;
+}
+
+/*
+ * Função: obterSala
+ * Propósito: Garante que o identificador exista no vetor de salas
+ *            (permite que ligações apareçam antes da definição da sala)
+ * Parâmetros: mansao - mansão em construção
+ *            id - identificador da sala no arquivo
+ * Retorno: void
+ */
+void obterSala(Mansao* mansao, uint32_t id) {
+    // Cresce os vetores por identificador se necessário
+    if (id >= mansao->capacidade) {
+        uint32_t antiga = mansao->capacidade;
+        size_t novaCapacidade = antiga > 0 ? antiga : CAPACIDADE_SALAS_INICIAL;
+        while (id >= novaCapacidade) {
+            novaCapacidade *= 2;
+        }
+        if (novaCapacidade > SEM_SALA) {
+            novaCapacidade = SEM_SALA;
+        }
+        Sala* novasSalas = (Sala*)realloc(mansao->salas, novaCapacidade * sizeof(Sala));
+        uint32_t* novosNomes = novasSalas != NULL
+                               ? (uint32_t*)realloc(mansao->nomes, novaCapacidade * sizeof(uint32_t)) : NULL;
+        uint8_t* novoTemPai = novosNomes != NULL ? (uint8_t*)realloc(mansao->temPai, novaCapacidade) : NULL;
+        if (novasSalas == NULL || novosNomes == NULL || novoTemPai == NULL) {
+            printf("Erro: Não foi possível alocar memória para a mansão.\n");
+            exit(1);
+        }
+        // Salas novas começam provisórias: sem nome até a linha "S" correspondente
+        for (uint32_t i = antiga; i < novaCapacidade; i++) {
+            novosNomes[i] = STRING_INEXISTENTE;
+            novasSalas[i].pista = STRING_VAZIA;
+            novasSalas[i].esquerda = SEM_SALA;
+            novasSalas[i].direita = SEM_SALA;
+        }
+        memset(novoTemPai + antiga, 0, novaCapacidade - antiga);
+        mansao->salas = novasSalas;
+        mansao->nomes = novosNomes;
+        mansao->temPai = novoTemPai;
+        mansao->capacidade = (uint32_t)novaCapacidade;
+    }
+    if (id >= mansao->quantidade) {
+        mansao->quantidade = id + 1;
+    }
+}
+
+/*
+ * Função: criarSala
+ * Propósito: Define nome e pista da sala de um identificador
+ * Parâmetros: mansao - mansão em construção
+ *            id - identificador da sala
+ *            nome - string com o nome da sala
+ *            pista - string com a pista (pode ser vazia)
+ * Retorno: 1 se a sala foi criada, 0 se o identificador já tinha sido definido
+ */
+int criarSala(Mansao* mansao, uint32_t id, const char* nome, const char* pista) {
+    obterSala(mansao, id);
+    if (mansao->nomes[id] != STRING_INEXISTENTE) {
+        return 0;
+    }
+    
+    mansao->nomes[id] = internarString(nome);
+    mansao->salas[id].pista = internarString(pista);
+    return 1;
+}
+
+/*
+ * Função: ligarSala
+ * Propósito: Registra uma sala filha, verificando a estrutura de árvore
+ * Parâmetros: mansao - mansão em construção
+ *            filho - identificador da sala filha (SEM_SALA = sem saída)
+ *            numeroLinha - linha atual (para mensagens de erro)
+ * Retorno: identificador da sala filha (ou SEM_SALA)
+ */
+uint32_t ligarSala(Mansao* mansao, uint32_t filho, long numeroLinha) {
+    if (filho == SEM_SALA) {
+        return SEM_SALA;
+    }
+    
+    obterSala(mansao, filho);
+    if (filho == 0 || mansao->temPai[filho]) {
+        erroCaso(numeroLinha, "sala com mais de uma entrada (a mansão deve ser uma árvore)");
+    }
+    mansao->temPai[filho] = 1;
+    return filho;
+}
+
+/*
+ * Função: adicionarPassagem
+ * Propósito: Registra uma passagem de mão única entre duas salas (pode formar ciclos)
+ * Parâmetros: mansao - mansão em construção
+ *            origem - sala onde a passagem começa
+ *            destino - sala aonde a passagem leva
+ * Retorno: void
+ */
+void adicionarPassagem(Mansao* mansao, uint32_t origem, uint32_t destino) {
+    obterSala(mansao, origem);
+    obterSala(mansao, destino);
+    
+    if (mansao->numPassagens == mansao->capacidadePassagens) {
+        uint32_t novaCapacidade = mansao->capacidadePassagens > 0
+                                  ? mansao->capacidadePassagens * 2 : CAPACIDADE_PASSAGENS_INICIAL;
+        uint32_t* novasPassagens = (uint32_t*)realloc(mansao->passagens, 2 * (size_t)novaCapacidade * sizeof(uint32_t));
+        if (novasPassagens == NULL) {
+            printf("Erro: Não foi possível alocar memória para a mansão.\n");
+            exit(1);
+        }
+        mansao->passagens = novasPassagens;
+        mansao->capacidadePassagens = novaCapacidade;
+    }
+    mansao->passagens[2 * mansao->numPassagens] = origem;
+    mansao->passagens[2 * mansao->numPassagens + 1] = destino;
+    mansao->numPassagens++;
+}
+
+/*
+ * Função: montarSaidas
+ * Propósito: Monta a lista de saídas de cada sala em formato CSR (contagem e soma de
+ *            prefixos): esquerda, direita e as passagens da sala na ordem do arquivo
+ * Parâmetros: mansao - mansão carregada (as passagens temporárias são liberadas)
+ * Retorno: void
+ */
+void montarSaidas(Mansao* mansao) {
+    uint32_t n = mansao->quantidade;
+    uint32_t* inicio = (uint32_t*)calloc((size_t)n + 1, sizeof(uint32_t));
+    uint32_t* proxima = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (inicio == NULL || proxima == NULL) {
+        printf("Erro: Não foi possível alocar memória para a mansão.\n");
+        exit(1);
+    }
+    
+    // Grau de cada sala em inicio[id + 1]; a soma de prefixos vira o início de cada lista
+    for (uint32_t id = 0; id < n; id++) {
+        inicio[id + 1] = (mansao->salas[id].esquerda != SEM_SALA) + (mansao->salas[id].direita != SEM_SALA);
+    }
+    for (uint32_t i = 0; i < mansao->numPassagens; i++) {
+        inicio[mansao->passagens[2 * i] + 1]++;
+    }
+    for (uint32_t id = 0; id < n; id++) {
+        inicio[id + 1] += inicio[id];
+    }
+    
+    uint32_t total = inicio[n];
+    uint32_t* saidas = (uint32_t*)malloc((total > 0 ? total : 1) * sizeof(uint32_t));
+    if (saidas == NULL) {
+        printf("Erro: Não foi possível alocar memória para a mansão.\n");
+        exit(1);
+    }
+    for (uint32_t id = 0; id < n; id++) {
+        proxima[id] = inicio[id];
+        if (mansao->salas[id].esquerda != SEM_SALA) {
+            saidas[proxima[id]++] = mansao->salas[id].esquerda;
+        }
+        if (mansao->salas[id].direita != SEM_SALA) {
+            saidas[proxima[id]++] = mansao->salas[id].direita;
+        }
+    }
+    for (uint32_t i = 0; i < mansao->numPassagens; i++) {
+        uint32_t origem = mansao->passagens[2 * i];
+        saidas[proxima[origem]++] = mansao->passagens[2 * i + 1];
+    }
+    
+    free(proxima);
+    free(mansao->passagens);
+    mansao->passagens = NULL;
+    mansao->numPassagens = mansao->capacidadePassagens = 0;
+    mansao->inicioSaidas = inicio;
+    mansao->saidas = saidas;
+    mansao->numSaidas = total;
+}
+
+/*
+ * Função: verificarArvores
+ * Propósito: Garante que as ligações "L" formam árvores: toda sala deve descender de uma
+ *            sala sem pai (ciclos só são permitidos com passagens "C")
+ * Parâmetros: mansao - mansão carregada (temPai ainda disponível)
+ * Retorno: void (encerra o programa se houver um ciclo de ligações)
+ */
+void verificarArvores(Mansao* mansao) {
+    uint32_t n = mansao->quantidade;
+    uint32_t* pilha = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (pilha == NULL) {
+        printf("Erro: Não foi possível alocar memória para a mansão.\n");
+        exit(1);
+    }
+    
+    // Percurso iterativo a partir de cada raiz; cada sala tem no máximo um pai, então
+    // nenhuma é empilhada duas vezes
+    uint32_t alcancadas = 0;
+    for (uint32_t raiz = 0; raiz < n; raiz++) {
+        if (mansao->temPai[raiz]) {
+            continue;
+        }
+        uint32_t topo = 0;
+        pilha[topo++] = raiz;
+        while (topo > 0) {
+            const Sala* sala = &mansao->salas[pilha[--topo]];
+            alcancadas++;
+            if (sala->esquerda != SEM_SALA) {
+                pilha[topo++] = sala->esquerda;
+            }
+            if (sala->direita != SEM_SALA) {
+                pilha[topo++] = sala->direita;
+            }
+        }
+    }
+    free(pilha);
+    
+    if (alcancadas != n) {
+        printf("Erro: as ligações do arquivo de caso formam um ciclo (use passagens \"C\" para ciclos).\n");
+        exit(1);
+    }
+}
+
+/*
+ * Função: carregarMansao
+ * Propósito: Lê um arquivo de caso em uma única passada, criando salas, ligações e
+ *            associações pista-suspeito (a sala 0 é a entrada da mansão)
+ * Parâmetros: arquivo - arquivo de caso aberto para leitura
+ *            mansao - mansão a ser preenchida (deve estar zerada)
+ * Retorno: void
+ */
+void carregarMansao(FILE* arquivo, Mansao* mansao) {
+    char* linha = NULL;
+    size_t capacidadeLinha = 0;
+    long numeroLinha = 0;
+    char* campos[MAX_CAMPOS_CASO] = {NULL}; // Campos ausentes ficam NULL
+    
+    while (getline(&linha, &capacidadeLinha, arquivo) != -1) {
+        numeroLinha++;
+        int numCampos = separarCampos(linha, campos);
+        
+        // Linhas vazias e comentários são ignorados
+        if (campos[0][0] == '\0' || campos[0][0] == '#') {
+            continue;
+        }
+        if (campos[0][1] != '\0') {
+            erroCaso(numeroLinha, "tipo de registro desconhecido");
+        }
+        
+        switch (campos[0][0]) {
+            case 'S':
+                // S <id> <nome> [pista]
+                if (numCampos < 3) {
+                    erroCaso(numeroLinha, "sala sem nome");
+                }
+                if (!criarSala(mansao, lerIdSala(campos[1], numeroLinha), campos[2],
+                               numCampos > 3 ? campos[3] : "")) {
+                    erroCaso(numeroLinha, "sala definida mais de uma vez");
+                }
+                break;
+                
+            case 'L': {
+                // L <id> <esquerda|-> <direita|->
+                if (numCampos < 4) {
+                    erroCaso(numeroLinha, "ligação incompleta");
+                }
+                uint32_t pai = lerIdSala(campos[1], numeroLinha);
+                if (pai == SEM_SALA) {
+                    erroCaso(numeroLinha, "ligação sem sala de origem");
+                }
+                // Uma segunda ligação deixaria os filhos da primeira sem entrada
+                obterSala(mansao, pai);
+                if (mansao->salas[pai].esquerda != SEM_SALA || mansao->salas[pai].direita != SEM_SALA) {
+                    erroCaso(numeroLinha, "sala já tem ligações");
+                }
+                uint32_t esquerda = ligarSala(mansao, lerIdSala(campos[2], numeroLinha), numeroLinha);
+                uint32_t direita = ligarSala(mansao, lerIdSala(campos[3], numeroLinha), numeroLinha);
+                mansao->salas[pai].esquerda = esquerda;
+                mansao->salas[pai].direita = direita;
+                break;
+            }
+            case 'C': {
+                // C <id> <destino>: passagem de mão única, fora da árvore (corredores, escadas, ciclos)
+                if (numCampos < 3) {
+                    erroCaso(numeroLinha, "passagem incompleta");
+                }
+                uint32_t origem = lerIdSala(campos[1], numeroLinha);
+                uint32_t destino = lerIdSala(campos[2], numeroLinha);
+                if (origem == SEM_SALA || destino == SEM_SALA) {
+                    erroCaso(numeroLinha, "passagem sem sala de origem ou de destino");
+                }
+                adicionarPassagem(mansao, origem, destino);
+                break;
+            }
+            case 'P':
+                // P <pista> <suspeito>
+                if (numCampos < 3 || campos[1][0] == '\0') {
+                    erroCaso(numeroLinha, "associação pista-suspeito incompleta");
+                }
+                inserirNaHash(campos[1], campos[2]);
+                break;
+                
+            default:
+                erroCaso(numeroLinha, "tipo de registro desconhecido");
+        }
+    }
+    free(linha);
+    
+    // Os identificadores precisam ser contíguos e todos definidos
+    for (uint32_t id = 0; id < mansao->quantidade; id++) {
+        if (mansao->nomes[id] == STRING_INEXISTENTE) {
+            printf("Erro: a sala %u nunca foi definida.\n", id);
+            exit(1);
+        }
+    }
+    if (mansao->quantidade == 0) {
+        printf("Erro: o arquivo de caso não define a sala de entrada (0).\n");
+        exit(1);
+    }
+    
+    // A marcação de entradas só é necessária durante a carga
+    verificarArvores(mansao);
+    free(mansao->temPai);
+    mansao->temPai = NULL;
+    montarSaidas(mansao);
+}
+
+/*
+ * Função: ordenarEmLargura
+ * Propósito: Lista as salas alcançáveis a partir da entrada, em largura
+ * Parâmetros: ordem - vetor de saída (capacidade >= mansao.quantidade)
+ * Retorno: quantidade de salas alcançáveis
+ */
+uint32_t ordenarEmLargura(uint32_t* ordem) {
+    uint32_t fim = 0;
+    ordem[fim++] = 0;
+    for (uint32_t i = 0; i < fim; i++) {
+        const Sala* sala = &mansao.salas[ordem[i]];
+        // A fila é lida na ordem em que é escrita: antecipa os próximos da fila
+        if (sala->esquerda != SEM_SALA) {
+            prefetcharSala(sala->esquerda);
+            ordem[fim++] = sala->esquerda;
+        }
+        if (sala->direita != SEM_SALA) {
+            prefetcharSala(sala->direita);
+            ordem[fim++] = sala->direita;
+        }
+    }
+    return fim;
+}
+
+// Tarefa do layout van Emde Boas: dispor as salas a menos de "limite" níveis abaixo de "sala"
+typedef struct TarefaVeb {
+    uint32_t sala;
+    uint32_t limite;
+} TarefaVeb;
+
+/*
+ * Função: ordenarVanEmdeBoas
+ * Propósito: Lista as salas alcançáveis na ordem van Emde Boas: a metade de cima de cada
+ *            subárvore vem antes, seguida das subárvores de baixo (recursivamente), de
+ *            modo que um caminho raiz-folha toca O(log_B n) blocos de cache
+ * Parâmetros: ordem - vetor de saída (capacidade >= mansao.quantidade)
+ * Retorno: quantidade de salas alcançáveis
+ */
+uint32_t ordenarVanEmdeBoas(uint32_t* ordem) {
+    uint32_t n = mansao.quantidade;
+    uint32_t* altura = (uint32_t*)malloc(n * sizeof(uint32_t));
+    size_t capacidadeTarefas = CAPACIDADE_SALAS_INICIAL, capacidadeFronteira = CAPACIDADE_SALAS_INICIAL;
+    TarefaVeb* tarefas = (TarefaVeb*)malloc(capacidadeTarefas * sizeof(TarefaVeb));
+    TarefaVeb* fronteira = (TarefaVeb*)malloc(capacidadeFronteira * sizeof(TarefaVeb));
+    if (altura == NULL || tarefas == NULL || fronteira == NULL) {
+        printf("Erro: Não foi possível alocar memória para reordenar as salas.\n");
+        exit(1);
+    }
+    
+    // Altura de cada subárvore (em largura invertida: filhos antes do pai)
+    uint32_t alcancaveis = ordenarEmLargura(ordem);
+    for (uint32_t i = alcancaveis; i-- > 0; ) {
+        const Sala* sala = &mansao.salas[ordem[i]];
+        uint32_t alturaEsquerda = sala->esquerda != SEM_SALA ? altura[sala->esquerda] : 0;
+        uint32_t alturaDireita = sala->direita != SEM_SALA ? altura[sala->direita] : 0;
+        altura[ordem[i]] = 1 + (alturaEsquerda > alturaDireita ? alturaEsquerda : alturaDireita);
+    }
+    
+    uint32_t escritas = 0;
+    size_t numTarefas = 0;
+    tarefas[numTarefas++] = (TarefaVeb){0, altura[0]};
+    while (numTarefas > 0) {
+        TarefaVeb tarefa = tarefas[--numTarefas];
+        uint32_t limite = tarefa.limite < altura[tarefa.sala] ? tarefa.limite : altura[tarefa.sala];
+        if (limite == 1) {
+            ordem[escritas++] = tarefa.sala;
+            continue;
+        }
+        
+        // Salas exatamente "alturaTopo" níveis abaixo, da esquerda para a direita:
+        // raízes das subárvores de baixo (percurso em profundidade limitado)
+        uint32_t alturaTopo = limite / 2;
+        size_t numFronteira = 0, inicioFronteira;
+        fronteira[numFronteira++] = (TarefaVeb){tarefa.sala, 0};
+        inicioFronteira = numTarefas;
+        while (numFronteira > 0) {
+            TarefaVeb atual = fronteira[--numFronteira];
+            if (atual.limite == alturaTopo) {
+                if (numTarefas == capacidadeTarefas) {
+                    capacidadeTarefas *= 2;
+                    TarefaVeb* novasTarefas = (TarefaVeb*)realloc(tarefas, capacidadeTarefas * sizeof(TarefaVeb));
+                    if (novasTarefas == NULL) {
+                        printf("Erro: Não foi possível alocar memória para reordenar as salas.\n");
+                        exit(1);
+                    }
+                    tarefas = novasTarefas;
+                }
+                tarefas[numTarefas++] = (TarefaVeb){atual.sala, limite - alturaTopo};
+                continue;
+            }
+            if (numFronteira + 2 > capacidadeFronteira) {
+                capacidadeFronteira *= 2;
+                TarefaVeb* novaFronteira = (TarefaVeb*)realloc(fronteira, capacidadeFronteira * sizeof(TarefaVeb));
+                if (novaFronteira == NULL) {
+                    printf("Erro: Não foi possível alocar memória para reordenar as salas.\n");
+                    exit(1);
+                }
+                fronteira = novaFronteira;
+            }
+            const Sala* sala = &mansao.salas[atual.sala];
+            if (sala->direita != SEM_SALA) {
+                fronteira[numFronteira++] = (TarefaVeb){sala->direita, atual.limite + 1};
+            }
+            if (sala->esquerda != SEM_SALA) {
+                fronteira[numFronteira++] = (TarefaVeb){sala->esquerda, atual.limite + 1};
+            }
+        }
+        
+        // Pilha: as subárvores de baixo foram empilhadas da esquerda para a direita; inverte
+        // para que a mais à esquerda saia primeiro, e empilha a metade de cima por último
+        for (size_t i = inicioFronteira, j = numTarefas; i + 1 < j; i++, j--) {
+            TarefaVeb troca = tarefas[i];
+            tarefas[i] = tarefas[j - 1];
+            tarefas[j - 1] = troca;
+        }
+        if (numTarefas == capacidadeTarefas) {
+            capacidadeTarefas *= 2;
+            TarefaVeb* novasTarefas = (TarefaVeb*)realloc(tarefas, capacidadeTarefas * sizeof(TarefaVeb));
+            if (novasTarefas == NULL) {
+                printf("Erro: Não foi possível alocar memória para reordenar as salas.\n");
+                exit(1);
+            }
+            tarefas = novasTarefas;
+        }
+        tarefas[numTarefas++] = (TarefaVeb){tarefa.sala, alturaTopo};
+    }
+    
+    free(altura);
+    free(tarefas);
+    free(fronteira);
+    return escritas;
+}
+
+/*
+ * Função: reordenarMansao
+ * Propósito: Renumera as salas na ordem pedida (a entrada continua sendo a sala 0 e
+ *            salas fora da árvore da entrada vão para o fim, na ordem original); as
+ *            passagens não influem na ordem, só são renumeradas
+ * Parâmetros: ordem - ORDEM_LARGURA ou ORDEM_VEB (ORDEM_ARQUIVO não altera nada)
+ * Retorno: void
+ */
+void reordenarMansao(OrdemSalas ordem) {
+    if (ordem == ORDEM_ARQUIVO) {
+        return;
+    }
+    
+    uint32_t n = mansao.quantidade;
+    uint32_t* lista = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint32_t* novoId = (uint32_t*)malloc(n * sizeof(uint32_t));
+    Sala* novasSalas = (Sala*)malloc(n * sizeof(Sala));
+    uint32_t* novosNomes = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint32_t* novoInicio = (uint32_t*)malloc(((size_t)n + 1) * sizeof(uint32_t));
+    uint32_t* novasSaidas = (uint32_t*)malloc((mansao.numSaidas > 0 ? mansao.numSaidas : 1) * sizeof(uint32_t));
+    if (lista == NULL || novoId == NULL || novasSalas == NULL || novosNomes == NULL
+        || novoInicio == NULL || novasSaidas == NULL) {
+        printf("Erro: Não foi possível alocar memória para reordenar as salas.\n");
+        exit(1);
+    }
+    
+    uint32_t alcancaveis = ordem == ORDEM_LARGURA ? ordenarEmLargura(lista) : ordenarVanEmdeBoas(lista);
+    memset(novoId, 0xff, n * sizeof(uint32_t));
+    for (uint32_t i = 0; i < alcancaveis; i++) {
+        novoId[lista[i]] = i;
+    }
+    for (uint32_t id = 0, proximo = alcancaveis; id < n; id++) {
+        if (novoId[id] == SEM_SALA) {
+            novoId[id] = proximo++;
+        }
+    }
+    
+    for (uint32_t id = 0; id < n; id++) {
+        Sala sala = mansao.salas[id];
+        sala.esquerda = sala.esquerda != SEM_SALA ? novoId[sala.esquerda] : SEM_SALA;
+        sala.direita = sala.direita != SEM_SALA ? novoId[sala.direita] : SEM_SALA;
+        novasSalas[novoId[id]] = sala;
+        novosNomes[novoId[id]] = mansao.nomes[id];
+    }
+    
+    // Saídas: grau na nova posição, soma de prefixos e cópia renumerada (mesma ordem)
+    novoInicio[0] = 0;
+    for (uint32_t id = 0; id < n; id++) {
+        novoInicio[novoId[id] + 1] = grauSala(id);
+    }
+    for (uint32_t id = 0; id < n; id++) {
+        novoInicio[id + 1] += novoInicio[id];
+    }
+    for (uint32_t id = 0; id < n; id++) {
+        const uint32_t* saidas = saidasDaSala(id);
+        uint32_t* destino = &novasSaidas[novoInicio[novoId[id]]];
+        for (uint32_t i = 0, grau = grauSala(id); i < grau; i++) {
+            destino[i] = novoId[saidas[i]];
+        }
+    }
+    
+    free(mansao.salas);
+    free(mansao.nomes);
+    free(mansao.inicioSaidas);
+    free(mansao.saidas);
+    mansao.salas = novasSalas;
+    mansao.nomes = novosNomes;
+    mansao.inicioSaidas = novoInicio;
+    mansao.saidas = novasSaidas;
+    mansao.capacidade = n;
+    free(lista);
+    free(novoId);
+}
+
+/*
+ * Função: lerOrdemSalas
+ * Propósito: Converte o argumento de --ordem
+ * Parâmetros: texto - "arquivo", "largura" ou "veb"
+ * Retorno: ordem correspondente (encerra o programa se for inválida)
+ */
+OrdemSalas lerOrdemSalas(const char* texto) {
+    if (strcmp(texto, "arquivo") == 0) {
+        return ORDEM_ARQUIVO;
+    }
+    if (strcmp(texto, "largura") == 0) {
+        return ORDEM_LARGURA;
+    }
+    if (strcmp(texto, "veb") == 0) {
+        return ORDEM_VEB;
+    }
+    printf("Erro: ordem de salas desconhecida '%s' (use arquivo, largura ou veb).\n", texto);
+    exit(1);
+}
@@ -0,0 +1,101 @@
+#ifndef NUCLEO_MANSAO_H
+#define NUCLEO_MANSAO_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "memoria.h"
+#include "textos.h"
+
+#define SEM_SALA UINT32_MAX              // Saída inexistente ("-" no arquivo de caso)
+#define CAPACIDADE_SALAS_INICIAL 16      // Capacidade inicial do vetor de salas do carregador
+#define FOLGA_IDS_SALA (1u << 20)        // Identificadores aceitos além de 2 por linha lida (salas citadas antes da linha S)
+#define MAX_CAMPOS_CASO 4                // Máximo de campos em uma linha do arquivo de caso
+#define CAPACIDADE_PASSAGENS_INICIAL 16  // Capacidade inicial (em pares) das passagens do carregador
+
+// Definição da estrutura que representa uma sala da mansão (sem ponteiros: pode ser mapeada do disco).
+// Só os campos lidos a cada passo de um percurso ficam aqui; o nome (usado apenas na exibição)
+// fica em Mansao.nomes, então uma linha de cache comporta mais salas
+typedef struct Sala {
+    uint32_t esquerda;       // Identificador do cômodo à esquerda (SEM_SALA se não houver)
+    uint32_t direita;        // Identificador do cômodo à direita (SEM_SALA se não houver)
+    uint32_t pista;          // Pista encontrada na sala (STRING_VAZIA se não houver)
+} Sala;
+
+// Ordem das salas no vetor da mansão (a entrada é sempre a sala 0)
+typedef enum OrdemSalas {
+    ORDEM_ARQUIVO,           // Identificadores do arquivo de caso
+    ORDEM_LARGURA,           // Em largura (Eytzinger generalizado para árvores incompletas)
+    ORDEM_VEB                // van Emde Boas: subárvores de altura ~h/2 contíguas, recursivamente
+} OrdemSalas;
+
+// Mansão: vetor contíguo de salas indexado pelo identificador (a sala 0 é a entrada).
+// Esquerda e direita formam a árvore de ligações "L", usada pelas dicas, pelo resolvedor e
+// pelas ordens de salas. O jogador anda pelo grafo completo, que inclui as passagens "C"
+// (com ciclos): as saídas de todas as salas ficam em um único vetor, em formato CSR
+typedef struct Mansao {
+    Sala* salas;                  // Campos de percurso das salas, indexados pelo identificador
+    uint32_t* nomes;              // Nome de cada sala (identificador na tabela de strings)
+    uint8_t* temPai;              // Marca salas que já são filhas de outra (só durante a carga)
+    uint32_t quantidade;          // Maior identificador referenciado + 1
+    uint32_t capacidade;          // Capacidade alocada dos vetores
+    uint32_t* inicioSaidas;       // Saídas da sala id: saidas[inicioSaidas[id] .. inicioSaidas[id + 1])
+    uint32_t* saidas;             // Destinos: esquerda e direita (se houver), depois as passagens
+    uint32_t numSaidas;           // Total de saídas (inicioSaidas[quantidade])
+    uint32_t* passagens;          // Pares (origem, destino) das linhas "C" (só durante a carga)
+    uint32_t numPassagens;        // Pares lidos
+    uint32_t capacidadePassagens; // Capacidade alocada (em pares)
+} Mansao;
+
+extern const char* CASO_PADRAO;
+extern Mansao mansao;
+extern OrdemSalas ordemSalas;
+
+/*
+ * Função: prefetcharSala
+ * Propósito: Antecipa a leitura de uma sala que o percurso vai visitar em breve
+ * Parâmetros: id - identificador da sala (SEM_SALA é ignorado)
+ * Retorno: void
+ */
+static inline void prefetcharSala(uint32_t id) {
+    if (id != SEM_SALA) {
+        prefetchar(&mansao.salas[id]);
+    }
+}
+
+/*
+ * Função: grauSala
+ * Propósito: Conta as saídas de uma sala (ligações da árvore e passagens)
+ * Parâmetros: id - identificador da sala
+ * Retorno: número de saídas
+ */
+static inline uint32_t grauSala(uint32_t id) {
+    return mansao.inicioSaidas[id + 1] - mansao.inicioSaidas[id];
+}
+
+/*
+ * Função: saidasDaSala
+ * Propósito: Localiza as saídas de uma sala no vetor CSR
+ * Parâmetros: id - identificador da sala
+ * Retorno: ponteiro para as grauSala(id) saídas da sala
+ */
+static inline const uint32_t* saidasDaSala(uint32_t id) {
+    return &mansao.saidas[mansao.inicioSaidas[id]];
+}
+
+void erroCaso(long numeroLinha, const char* mensagem);
+int separarCampos(char* linha, char* campos[MAX_CAMPOS_CASO]);
+uint32_t lerIdSala(const char* campo, long numeroLinha);
+void obterSala(Mansao* mansao, uint32_t id);
+int criarSala(Mansao* mansao, uint32_t id, const char* nome, const char* pista);
+uint32_t ligarSala(Mansao* mansao, uint32_t filho, long numeroLinha);
+void verificarArvores(Mansao* mansao);
+void adicionarPassagem(Mansao* mansao, uint32_t origem, uint32_t destino);
+void montarSaidas(Mansao* mansao);
+void carregarMansao(FILE* arquivo, Mansao* mansao);
+uint32_t ordenarEmLargura(uint32_t* ordem);
+uint32_t ordenarVanEmdeBoas(uint32_t* ordem);
+void reordenarMansao(OrdemSalas ordem);
+OrdemSalas lerOrdemSalas(const char* texto);
+
+#endif
@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "memoria.h"
+
+/*
+ * Função: alocarNaArena
+ * Propósito: Reserva memória contígua na arena (sem liberação individual)
+ * Parâmetros: arena - arena de onde a memória será retirada
+ *            tamanho - quantidade de bytes desejada
+ * Retorno: ponteiro para a memória reservada (alinhada para qualquer tipo)
+ */
+void* alocarNaArena(Arena* arena, size_t tamanho) {
+    // Arredonda para manter o alinhamento das próximas alocações
+    size_t alinhamento = _Alignof(max_align_t);
+    tamanho = (tamanho + alinhamento - 1) & ~(alinhamento - 1);
+    
+    BlocoArena* bloco = arena->atual;
+    if (bloco == NULL || bloco->usado + tamanho > bloco->capacidade) {
+        size_t capacidade = tamanho > TAMANHO_BLOCO_ARENA ? tamanho : TAMANHO_BLOCO_ARENA;
+        BlocoArena* novoBloco = (BlocoArena*)malloc(sizeof(BlocoArena) + capacidade);
+        
+        if (novoBloco == NULL) {
+            printf("Erro: Não foi possível alocar memória para a arena.\n");
+            exit(1);
+        }
+        
+        novoBloco->anterior = bloco;
+        novoBloco->usado = 0;
+        novoBloco->capacidade = capacidade;
+        arena->atual = novoBloco;
+        bloco = novoBloco;
+    }
+    
+    void* memoria = bloco->dados + bloco->usado;
+    bloco->usado += tamanho;
+    return memoria;
+}
+
+/*
+ * Função: liberarArena
+ * Propósito: Devolve de uma só vez todos os blocos da arena
+ * Parâmetros: arena - arena a ser liberada
+ * Retorno: void
+ */
+void liberarArena(Arena* arena) {
+    BlocoArena* bloco = arena->atual;
+    while (bloco != NULL) {
+        BlocoArena* anterior = bloco->anterior;
+        free(bloco);
+        bloco = anterior;
+    }
+    arena->atual = NULL;
+}
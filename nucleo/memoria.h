@@ -0,0 +1,38 @@
+#ifndef NUCLEO_MEMORIA_H
+#define NUCLEO_MEMORIA_H
+
+#include <stddef.h>
+
+#define TAMANHO_BLOCO_ARENA (64 * 1024)  // Tamanho padrão de cada bloco da arena (bytes)
+
+// Bloco de memória da arena (os blocos formam uma lista ligada)
+typedef struct BlocoArena {
+    struct BlocoArena* anterior;  // Bloco alocado antes deste
+    size_t usado;                 // Bytes já entregues deste bloco
+    size_t capacidade;            // Bytes disponíveis em "dados"
+    _Alignas(max_align_t) char dados[]; // Área de alocação
+} BlocoArena;
+
+// Arena de uma sessão: dona de todos os nós de pistas da investigação
+typedef struct Arena {
+    BlocoArena* atual;            // Bloco em uso (o mais recente)
+} Arena;
+
+/*
+ * Função: prefetchar
+ * Propósito: Antecipa a leitura de um endereço que será consultado em breve
+ * Parâmetros: endereco - posição de memória a ser trazida para o cache
+ * Retorno: void
+ */
+static inline void prefetchar(const void* endereco) {
+#if defined(__GNUC__)
+    __builtin_prefetch(endereco);
+#else
+    (void)endereco;
+#endif
+}
+
+void* alocarNaArena(Arena* arena, size_t tamanho);
+void liberarArena(Arena* arena);
+
+#endif
@@ -0,0 +1,275 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "niveis.h"
+#include "caso.h"
+#include "suspeitos.h"
+#include "instrumentacao.h"
+
+/*
+ * Função: apresentarNovato
+ * Propósito: Abertura do nível novato
+ * Parâmetros: sessao - investigação que produz a saída
+ * Retorno: void
+ */
+void apresentarNovato(Sessao* sessao) {
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "    BEM-VINDO À MANSÃO MISTERIOSA!     \n");
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "Explore os cômodos da mansão para encontrar pistas.\n");
+    mostrar(sessao, "Use 'e' para ir à esquerda, 'd' para a direita, 'v' para voltar ou 's' para sair.\n");
+    mostrar(sessao, "========================================\n");
+}
+
+/*
+ * Função: sairNovato
+ * Propósito: Encerra a exploração do nível novato a pedido do jogador
+ * Parâmetros: sessao - investigação que produz a saída
+ * Retorno: void
+ */
+void sairNovato(Sessao* sessao) {
+    mostrar(sessao, "Saindo do jogo... Obrigado por jogar!\n");
+}
+
+/*
+ * Função: apresentarAventureiro
+ * Propósito: Abertura do nível aventureiro
+ * Parâmetros: sessao - investigação que produz a saída
+ * Retorno: void
+ */
+void apresentarAventureiro(Sessao* sessao) {
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "       DETECTIVE QUEST - EXPANDIDO     \n");
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "Explore a mansão misteriosa e colete pistas\n");
+    mostrar(sessao, "para resolver o caso! As pistas serão\n");
+    mostrar(sessao, "organizadas alfabeticamente no final.\n");
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "Comandos: 'e' (esquerda), 'd' (direita), 'v' (voltar), 'b' (buscar), 's' (sair)\n");
+    mostrar(sessao, "========================================\n");
+}
+
+/*
+ * Função: relatorioAventureiro
+ * Propósito: Exibe o relatório final com as pistas coletadas em ordem alfabética
+ * Parâmetros: sessao - investigação encerrada
+ * Retorno: void
+ */
+void relatorioAventureiro(Sessao* sessao) {
+    mostrar(sessao, "\n========================================\n");
+    mostrar(sessao, "    RELATÓRIO FINAL DE INVESTIGAÇÃO    \n");
+    mostrar(sessao, "========================================\n");
+    
+    int totalPistas = contarPistas(sessao->raizPistas);
+    if (totalPistas > 0) {
+        mostrar(sessao, "Pistas coletadas (%d total):\n\n", totalPistas);
+        exibirPistas(sessao, sessao->raizPistas, 0);
+        mostrar(sessao, "\n========================================\n");
+        mostrar(sessao, "Investigação concluída! Analise as pistas\n");
+        mostrar(sessao, "para resolver o mistério da mansão.\n");
+    } else {
+        mostrar(sessao, "Nenhuma pista foi coletada durante a exploração.\n");
+        mostrar(sessao, "Tente explorar mais cômodos da mansão!\n");
+    }
+    mostrar(sessao, "========================================\n");
+}
+
+/*
+ * Função: apresentarMestre
+ * Propósito: Abertura do nível mestre
+ * Parâmetros: sessao - investigação que produz a saída
+ * Retorno: void
+ */
+void apresentarMestre(Sessao* sessao) {
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "    DETECTIVE QUEST - VERSÃO FINAL     \n");
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "Bem-vindo ao desafio final! Sua missão:\n");
+    mostrar(sessao, "• Explore a mansão e colete pistas\n");
+    mostrar(sessao, "• Associe as evidências aos suspeitos\n");
+    mostrar(sessao, "• Faça uma acusação baseada nas provas\n");
+    mostrar(sessao, "• Resolva o mistério da mansão!\n");
+    mostrar(sessao, "========================================\n");
+    mostrar(sessao, "REGRA: Você precisa de pelo menos 2 pistas\n");
+    mostrar(sessao, "apontando para o mesmo suspeito para vencer!\n");
+    mostrar(sessao, "========================================\n");
+}
+
+/*
+ * Função: verificarSuspeitoFinal
+ * Propósito: Conduz a fase de julgamento final do jogo
+ * Parâmetros: sessao - investigação em andamento (registra o acusado)
+ * Retorno: void
+ */
+void verificarSuspeitoFinal(Sessao* sessao) {
+    INSTRUMENTAR(uint64_t inicioRelatorio = relogioInstrumentacao();
+                 somarMetrica(METRICA_RELATORIOS, 1);)
+    mostrar(sessao, "\n========================================\n");
+    mostrar(sessao, "    FASE DE JULGAMENTO FINAL           \n");
+    mostrar(sessao, "========================================\n");
+    
+    int totalPistas = contarPistas(sessao->raizPistas);
+    if (totalPistas == 0) {
+        mostrar(sessao, "Nenhuma pista foi coletada! Não é possível fazer uma acusação.\n");
+        INSTRUMENTAR(medirDesde(METRICA_NS_RELATORIOS, inicioRelatorio);)
+        return;
+    }
+    
+    mostrar(sessao, "RELATÓRIO DE EVIDÊNCIAS COLETADAS:\n\n");
+    exibirPistas(sessao, sessao->raizPistas, 1);
+    
+    // Ranking dos suspeitos, do mais para o menos incriminado
+    int* ranking = (int*)malloc((suspeitos.quantidade + 1) * sizeof(int));
+    if (ranking == NULL) {
+        printf("Erro: Não foi possível alocar memória para o ranking.\n");
+        exit(1);
+    }
+    int numSuspeitos = listarSuspeitosRanqueados(sessao, ranking, suspeitos.quantidade);
+    
+    mostrar(sessao, "\n========================================\n");
+    mostrar(sessao, "ANÁLISE DE SUSPEITOS:\n\n");
+    
+    for (int i = 0; i < numSuspeitos; i++) {
+        int pistas = sessao->contagemSuspeitos[ranking[i]];
+        mostrar(sessao, "%d. %s (%d pista%s)\n", 
+               i + 1, 
+               textoDaString(suspeitos.nomes[ranking[i]]), 
+               pistas,
+               pistas == 1 ? "" : "s");
+    }
+    
+    mostrar(sessao, "\n========================================\n");
+    mostrar(sessao, "Baseado nas evidências coletadas, quem você acusa?\n");
+    mostrar(sessao, "Digite o número do suspeito (1-%d): ", numSuspeitos);
+    INSTRUMENTAR(medirDesde(METRICA_NS_RELATORIOS, inicioRelatorio);)
+    
+    int escolha = lerNumero(sessao);
+    
+    if (escolha < 1 || escolha > numSuspeitos) {
+        mostrar(sessao, "\nEscolha inválida! Julgamento cancelado.\n");
+        free(ranking);
+        return;
+    }
+    
+    sessao->acusado = ranking[escolha - 1];
+    sessao->pistasDoAcusado = sessao->contagemSuspeitos[sessao->acusado];
+    free(ranking);
+    
+    const char* suspeitoAcusado = textoDaString(suspeitos.nomes[sessao->acusado]);
+    int pistasDoSuspeito = sessao->pistasDoAcusado;
+    
+    mostrar(sessao, "\n========================================\n");
+    mostrar(sessao, "    VEREDICTO FINAL                    \n");
+    mostrar(sessao, "========================================\n");
+    
+    mostrar(sessao, "Você acusou: %s\n", suspeitoAcusado);
+    mostrar(sessao, "Evidências contra o acusado: %d pista%s\n\n", 
+           pistasDoSuspeito, 
+           pistasDoSuspeito == 1 ? "" : "s");
+    
+    if (pistasDoSuspeito >= 2) {
+        mostrar(sessao, "🎉 PARABÉNS! CASO RESOLVIDO! 🎉\n\n");
+        mostrar(sessao, "Você coletou evidências suficientes para sustentar\n");
+        mostrar(sessao, "sua acusação. %s foi considerado culpado!\n\n", suspeitoAcusado);
+        mostrar(sessao, "Com %d pistas apontando para o suspeito, o caso\n", pistasDoSuspeito);
+        mostrar(sessao, "foi encerrado com sucesso. Excelente trabalho, detetive!\n");
+    } else {
+        mostrar(sessao, "❌ CASO NÃO RESOLVIDO ❌\n\n");
+        mostrar(sessao, "Evidências insuficientes para sustentar a acusação.\n");
+        mostrar(sessao, "São necessárias pelo menos 2 pistas apontando para\n");
+        mostrar(sessao, "o mesmo suspeito. Você coletou apenas %d pista.\n\n", pistasDoSuspeito);
+        mostrar(sessao, "Continue explorando a mansão para encontrar mais\n");
+        mostrar(sessao, "evidências antes de fazer uma acusação!\n");
+    }
+    
+    mostrar(sessao, "========================================\n");
+}
+
+// Definição dos níveis: o que cada um mostra e como a exploração termina
+const Nivel NIVEL_NOVATO = {
+    .coletaPistas = 0,
+    .apontaSuspeitos = 0,
+    .temDicas = 0,
+    .temBusca = 0,
+    .paraSemSaida = 1,
+    .opcaoSair = "Sair do jogo",
+    .opcaoInvalida = "Opção inválida! Use 'e' para esquerda, 'd' para direita, 'v' para voltar ou 's' para sair.",
+    .despedida = NULL,
+    .apresentar = apresentarNovato,
+    .sair = sairNovato
+};
+
+const Nivel NIVEL_AVENTUREIRO = {
+    .coletaPistas = 1,
+    .apontaSuspeitos = 0,
+    .temDicas = 0,
+    .temBusca = 1,
+    .paraSemSaida = 0,
+    .opcaoSair = "Sair e ver relatório de pistas",
+    .opcaoInvalida = "Opção inválida! Use 'e' para esquerda, 'd' para direita, 'v' para voltar, 'b' para buscar ou 's' para sair.",
+    .despedida = "\nObrigado por jogar Detective Quest!\n",
+    .apresentar = apresentarAventureiro,
+    .sair = relatorioAventureiro
+};
+
+const Nivel NIVEL_MESTRE = {
+    .coletaPistas = 1,
+    .apontaSuspeitos = 1,
+    .temDicas = 1,
+    .temBusca = 1,
+    .paraSemSaida = 0,
+    .opcaoSair = "Finalizar exploração e fazer julgamento",
+    .opcaoInvalida = "Opção inválida! Use 'e' para esquerda, 'd' para direita, 'v' para voltar, 'h' para dica, 'b' para buscar ou 's' para finalizar.",
+    .despedida = "\nObrigado por jogar Detective Quest!\n",
+    .apresentar = apresentarMestre,
+    .sair = verificarSuspeitoFinal
+};
+
+/*
+ * Função: executarNivel
+ * Propósito: Linha de comando dos níveis novato e aventureiro: trata as opções (modo
+ *            lote e silencioso), carrega o caso e joga uma partida
+ * Parâmetros: nivel - nível jogado
+ *            argc, argv - argumentos recebidos por main
+ * Retorno: 0 se execução bem-sucedida
+ */
+int executarNivel(const Nivel* nivel, int argc, char* argv[]) {
+    const char* caso = NULL;
+    char* roteiro = NULL;
+    int modoSilencioso = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--lote") == 0 && i + 1 < argc && roteiro == NULL) {
+            roteiro = carregarRoteiro(argv[++i]);
+        } else if (strcmp(argv[i], "--silencioso") == 0) {
+            modoSilencioso = 1;
+        } else if (argv[i][0] == '-' && argv[i][1] == '-') {
+            printf("Uso: %s [--lote <roteiro|->] [--silencioso] [caso]\n", argv[0]);
+            exit(1);
+        } else {
+            caso = argv[i];
+        }
+    }
+    
+    // No modo lote toda a saída passa por um único buffer grande
+    if (roteiro != NULL && setvbuf(stdout, NULL, _IOFBF, TAMANHO_BUFFER_SAIDA) != 0) {
+        printf("Erro: Não foi possível configurar o buffer de saída.\n");
+        exit(1);
+    }
+    
+    // Carrega o caso informado (imagem compilada ou texto) ou a mansão padrão
+    carregarCaso(caso);
+    
+    // Inicia a exploração a partir do Hall de Entrada
+    Sessao sessao;
+    iniciarSessao(&sessao, nivel, modoSilencioso ? NULL : stdout, roteiro);
+    jogarSessao(&sessao);
+    encerrarSessao(&sessao);
+    
+    // Libera toda a memória alocada
+    liberarCaso();
+    free(roteiro);
+    
+    return 0;
+}
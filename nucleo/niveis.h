@@ -0,0 +1,21 @@
+#ifndef NUCLEO_NIVEIS_H
+#define NUCLEO_NIVEIS_H
+
+#include "sessao.h"
+
+#define TAMANHO_BUFFER_SAIDA (1 << 20) // Buffer de saída no modo lote (1 MiB)
+
+// Os três níveis do jogo (cada executável joga um deles)
+extern const Nivel NIVEL_NOVATO;         // Só a navegação pela mansão
+extern const Nivel NIVEL_AVENTUREIRO;    // Coleta de pistas e relatório em ordem alfabética
+extern const Nivel NIVEL_MESTRE;         // Suspeitos, dicas e julgamento final
+
+void apresentarNovato(Sessao* sessao);
+void sairNovato(Sessao* sessao);
+void apresentarAventureiro(Sessao* sessao);
+void relatorioAventureiro(Sessao* sessao);
+void apresentarMestre(Sessao* sessao);
+void verificarSuspeitoFinal(Sessao* sessao);
+int executarNivel(const Nivel* nivel, int argc, char* argv[]);
+
+#endif
@@ -0,0 +1,334 @@
+#include <string.h>
+
+#include "pistas.h"
+#include "suspeitos.h"
+#include "instrumentacao.h"
+
+/*
+ * Função: criarPistaNode
+ * Propósito: Cria na arena da sessão um novo nó para a árvore AVL de pistas
+ * Parâmetros: arena - arena da sessão dona da árvore
+ *            pista - identificador da pista na tabela de strings
+ * Retorno: ponteiro para o novo nó criado
+ */
+PistaNode* criarPistaNode(Arena* arena, uint32_t pista) {
+    PistaNode* novoNode = (PistaNode*)alocarNaArena(arena, sizeof(PistaNode));
+    
+    novoNode->pista = pista;
+    novoNode->altura = 1;
+    novoNode->tamanho = 1;
+    novoNode->esquerda = NULL;
+    novoNode->direita = NULL;
+    
+    return novoNode;
+}
+
+/*
+ * Função: copiarPistaNode
+ * Propósito: Copia um nó na arena (inserção persistente: o original continua intacto)
+ * Parâmetros: arena - arena da sessão dona da árvore
+ *            no - nó a ser copiado
+ * Retorno: ponteiro para a cópia
+ */
+PistaNode* copiarPistaNode(Arena* arena, const PistaNode* no) {
+    PistaNode* copia = (PistaNode*)alocarNaArena(arena, sizeof(PistaNode));
+    *copia = *no;
+    return copia;
+}
+
+/*
+ * Função: alturaPista
+ * Propósito: Obtém a altura de uma subárvore de pistas
+ * Parâmetros: no - raiz da subárvore (pode ser NULL)
+ * Retorno: altura da subárvore (0 se vazia)
+ */
+int alturaPista(PistaNode* no) {
+    return no != NULL ? no->altura : 0;
+}
+
+/*
+ * Função: tamanhoPista
+ * Propósito: Obtém a quantidade de pistas de uma subárvore
+ * Parâmetros: no - raiz da subárvore (pode ser NULL)
+ * Retorno: número de nós da subárvore (0 se vazia)
+ */
+int tamanhoPista(PistaNode* no) {
+    return no != NULL ? no->tamanho : 0;
+}
+
+/*
+ * Função: atualizarNo
+ * Propósito: Recalcula altura e tamanho de um nó a partir dos filhos
+ * Parâmetros: no - nó a ser atualizado
+ * Retorno: void
+ */
+void atualizarNo(PistaNode* no) {
+    int alturaEsquerda = alturaPista(no->esquerda);
+    int alturaDireita = alturaPista(no->direita);
+    no->altura = 1 + (alturaEsquerda > alturaDireita ? alturaEsquerda : alturaDireita);
+    no->tamanho = 1 + tamanhoPista(no->esquerda) + tamanhoPista(no->direita);
+}
+
+/*
+ * Função: rotacionarDireita
+ * Propósito: Rotaciona a subárvore para a direita (filho esquerdo sobe)
+ * Parâmetros: no - raiz da subárvore desbalanceada
+ * Retorno: nova raiz da subárvore
+ */
+PistaNode* rotacionarDireita(PistaNode* no) {
+    PistaNode* novaRaiz = no->esquerda;
+    no->esquerda = novaRaiz->direita;
+    novaRaiz->direita = no;
+    atualizarNo(no);
+    atualizarNo(novaRaiz);
+    return novaRaiz;
+}
+
+/*
+ * Função: rotacionarEsquerda
+ * Propósito: Rotaciona a subárvore para a esquerda (filho direito sobe)
+ * Parâmetros: no - raiz da subárvore desbalanceada
+ * Retorno: nova raiz da subárvore
+ */
+PistaNode* rotacionarEsquerda(PistaNode* no) {
+    PistaNode* novaRaiz = no->direita;
+    no->direita = novaRaiz->esquerda;
+    novaRaiz->esquerda = no;
+    atualizarNo(no);
+    atualizarNo(novaRaiz);
+    return novaRaiz;
+}
+
+/*
+ * Função: balancearPista
+ * Propósito: Atualiza a altura do nó e aplica as rotações AVL necessárias
+ * Parâmetros: no - raiz da subárvore
+ * Retorno: nova raiz da subárvore balanceada
+ */
+PistaNode* balancearPista(PistaNode* no) {
+    atualizarNo(no);
+    int fator = alturaPista(no->esquerda) - alturaPista(no->direita);
+    
+    if (fator > 1) {
+        // Caso esquerda-direita: rotação dupla
+        if (alturaPista(no->esquerda->esquerda) < alturaPista(no->esquerda->direita)) {
+            no->esquerda = rotacionarEsquerda(no->esquerda);
+        }
+        return rotacionarDireita(no);
+    }
+    if (fator < -1) {
+        // Caso direita-esquerda: rotação dupla
+        if (alturaPista(no->direita->direita) < alturaPista(no->direita->esquerda)) {
+            no->direita = rotacionarDireita(no->direita);
+        }
+        return rotacionarEsquerda(no);
+    }
+    
+    return no;
+}
+
+/*
+ * Função: rebalancearCaminho
+ * Propósito: Sobe pelo caminho de uma inserção rebalanceando enquanto a altura muda;
+ *            acima disso só o tamanho cresce
+ * Parâmetros: caminho - ligações percorridas da raiz até o pai do novo nó
+ *            profundidade - número de ligações em "caminho"
+ * Retorno: void
+ */
+void rebalancearCaminho(PistaNode** caminho[], int profundidade) {
+    int rebalancear = 1;
+    while (profundidade > 0) {
+        PistaNode** ligacao = caminho[--profundidade];
+        if (rebalancear) {
+            int alturaAnterior = (*ligacao)->altura;
+            *ligacao = balancearPista(*ligacao);
+            rebalancear = (*ligacao)->altura != alturaAnterior;
+        } else {
+            (*ligacao)->tamanho++;
+        }
+    }
+}
+
+/*
+ * Função: inserirPista
+ * Propósito: Insere uma nova pista na árvore AVL mantendo ordem alfabética
+ * Parâmetros: arena - arena da sessão onde o novo nó é criado
+ *            raiz - ponteiro para a raiz da árvore AVL
+ *            pista - identificador da pista na tabela de strings
+ * Retorno: ponteiro para a raiz da árvore (pode mudar após rotações)
+ */
+PistaNode* inserirPista(Arena* arena, PistaNode* raiz, uint32_t pista) {
+    PistaNode** caminho[ALTURA_MAXIMA_AVL];  // Ligações percorridas da raiz até o ponto de inserção
+    int profundidade = 0;
+    PistaNode** ligacao = &raiz;
+    INSTRUMENTAR(uint64_t inicioInsercao = relogioInstrumentacao();)
+    
+    // Desce iterativamente até a posição livre
+    while (*ligacao != NULL) {
+        if ((*ligacao)->pista == pista) {
+            INSTRUMENTAR(registrarInsercao(profundidade + 1, inicioInsercao);)
+            return raiz; // A pista já existe, não insere duplicata
+        }
+        int comparacao = strcmp(textoDaString(pista), textoDaString((*ligacao)->pista));
+        caminho[profundidade++] = ligacao;
+        ligacao = comparacao < 0 ? &(*ligacao)->esquerda : &(*ligacao)->direita;
+    }
+    *ligacao = criarPistaNode(arena, pista);
+    rebalancearCaminho(caminho, profundidade);
+    
+    INSTRUMENTAR(registrarInsercao(profundidade + 1, inicioInsercao);)
+    return raiz;
+}
+
+/*
+ * Função: inserirPistaPersistente
+ * Propósito: Insere uma pista sem alterar a versão recebida da árvore: os nós do caminho
+ *            são copiados (path copying) e o restante é compartilhado, então versões
+ *            anteriores continuam válidas para desfazer a jogada em O(1)
+ * Parâmetros: arena - arena da sessão onde as cópias e o novo nó são criados
+ *            raiz - raiz da versão atual (não é modificada)
+ *            pista - identificador da pista na tabela de strings
+ * Retorno: raiz da nova versão (a própria raiz recebida se a pista já existe)
+ */
+PistaNode* inserirPistaPersistente(Arena* arena, PistaNode* raiz, uint32_t pista) {
+    PistaNode** caminho[ALTURA_MAXIMA_AVL];  // Ligações (já nas cópias) da raiz até o ponto de inserção
+    uint8_t direitas[ALTURA_MAXIMA_AVL];     // Direção tomada em cada nível (1 = direita)
+    int profundidade = 0;
+    INSTRUMENTAR(uint64_t inicioInsercao = relogioInstrumentacao();)
+    
+    // Primeira descida: só localiza a posição, para não copiar nada se a pista já existe
+    for (PistaNode* no = raiz; no != NULL; profundidade++) {
+        if (no->pista == pista) {
+            INSTRUMENTAR(registrarInsercao(profundidade + 1, inicioInsercao);)
+            return raiz;
+        }
+        direitas[profundidade] = strcmp(textoDaString(pista), textoDaString(no->pista)) >= 0;
+        no = direitas[profundidade] ? no->direita : no->esquerda;
+    }
+    
+    // Segunda descida: copia o caminho; as rotações da inserção só tocam nós dele
+    PistaNode* novaRaiz = raiz;
+    PistaNode** ligacao = &novaRaiz;
+    for (int i = 0; i < profundidade; i++) {
+        *ligacao = copiarPistaNode(arena, *ligacao);
+        caminho[i] = ligacao;
+        ligacao = direitas[i] ? &(*ligacao)->direita : &(*ligacao)->esquerda;
+    }
+    *ligacao = criarPistaNode(arena, pista);
+    rebalancearCaminho(caminho, profundidade);
+    
+    INSTRUMENTAR(registrarInsercao(profundidade + 1, inicioInsercao);)
+    return novaRaiz;
+}
+
+/*
+ * Função: montarArvorePistas
+ * Propósito: Monta uma árvore AVL perfeitamente balanceada a partir de pistas já em
+ *            ordem alfabética, sem comparações nem rotações (recursão de altura log2 n)
+ * Parâmetros: arena - arena da sessão onde os nós são criados
+ *            pistas - identificadores em ordem alfabética, sem repetições
+ *            quantidade - número de pistas
+ * Retorno: raiz da árvore montada (NULL se quantidade == 0)
+ */
+PistaNode* montarArvorePistas(Arena* arena, const uint32_t* pistas, int quantidade) {
+    if (quantidade <= 0) {
+        return NULL;
+    }
+    
+    int meio = quantidade / 2;
+    PistaNode* no = criarPistaNode(arena, pistas[meio]);
+    no->esquerda = montarArvorePistas(arena, pistas, meio);
+    no->direita = montarArvorePistas(arena, pistas + meio + 1, quantidade - meio - 1);
+    atualizarNo(no);
+    
+    return no;
+}
+
+/*
+ * Função: listarPistasEmOrdem
+ * Propósito: Copia as pistas da árvore AVL em ordem alfabética (percurso iterativo)
+ * Parâmetros: raiz - raiz da árvore AVL de pistas
+ *            pistas - recebe raiz->tamanho identificadores
+ * Retorno: void
+ */
+void listarPistasEmOrdem(PistaNode* raiz, uint32_t* pistas) {
+    PistaNode* pilha[ALTURA_MAXIMA_AVL];
+    int topo = 0;
+    size_t quantidade = 0;
+    PistaNode* atual = raiz;
+    
+    while (atual != NULL || topo > 0) {
+        while (atual != NULL) {
+            pilha[topo++] = atual;
+            atual = atual->esquerda;
+        }
+        atual = pilha[--topo];
+        pistas[quantidade++] = atual->pista;
+        atual = atual->direita;
+    }
+}
+
+/*
+ * Função: buscarSuspeitosDaArvore
+ * Propósito: Lista as pistas da árvore em ordem e consulta todos os suspeitos em lote
+ * Parâmetros: raiz - raiz da árvore AVL de pistas (não vazia)
+ *            pistas - recebe raiz->tamanho identificadores de pista
+ *            idsSuspeitos - recebe o suspeito de cada pista (-1 se não houver)
+ * Retorno: void
+ */
+void buscarSuspeitosDaArvore(PistaNode* raiz, uint32_t* pistas, int* idsSuspeitos) {
+    listarPistasEmOrdem(raiz, pistas);
+    buscarSuspeitosEmLote(pistas, (size_t)raiz->tamanho, idsSuspeitos);
+}
+
+/*
+ * Função: contarPistas
+ * Propósito: Conta o número total de pistas coletadas
+ * Parâmetros: raiz - ponteiro para a raiz da árvore AVL
+ * Retorno: número inteiro com a quantidade de pistas (O(1), mantido na inserção)
+ */
+int contarPistas(PistaNode* raiz) {
+    return tamanhoPista(raiz);
+}
+
+/*
+ * Função: pistaNaPosicao
+ * Propósito: Localiza a k-ésima pista em ordem alfabética
+ * Parâmetros: raiz - ponteiro para a raiz da árvore AVL
+ *            posicao - posição desejada (a partir de 1)
+ * Retorno: ponteiro para o nó da pista ou NULL se a posição não existir
+ */
+PistaNode* pistaNaPosicao(PistaNode* raiz, int posicao) {
+    while (raiz != NULL) {
+        int tamanhoEsquerda = tamanhoPista(raiz->esquerda);
+        if (posicao <= tamanhoEsquerda) {
+            raiz = raiz->esquerda;
+        } else if (posicao == tamanhoEsquerda + 1) {
+            return raiz;
+        } else {
+            posicao -= tamanhoEsquerda + 1;
+            raiz = raiz->direita;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Função: contarPistasAntes
+ * Propósito: Conta quantas pistas coletadas vêm antes de um texto em ordem alfabética
+ * Parâmetros: raiz - ponteiro para a raiz da árvore AVL
+ *            conteudo - texto de referência (não precisa estar na árvore)
+ * Retorno: número de pistas estritamente menores que o conteúdo
+ */
+int contarPistasAntes(PistaNode* raiz, const char* conteudo) {
+    int antes = 0;
+    while (raiz != NULL) {
+        if (strcmp(conteudo, textoDaString(raiz->pista)) <= 0) {
+            raiz = raiz->esquerda;
+        } else {
+            antes += tamanhoPista(raiz->esquerda) + 1;
+            raiz = raiz->direita;
+        }
+    }
+    return antes;
+}
@@ -0,0 +1,38 @@
+#ifndef NUCLEO_PISTAS_H
+#define NUCLEO_PISTAS_H
+
+#include <stdint.h>
+
+#include "memoria.h"
+#include "textos.h"
+
+#define ALTURA_MAXIMA_AVL 64         // Limite da pilha de inserção (AVL com 2^44 pistas tem altura < 64)
+
+// Definição da estrutura para nós da árvore AVL de pistas
+typedef struct PistaNode {
+    uint32_t pista;               // Conteúdo da pista (identificador na tabela de strings)
+    int altura;                   // Altura da subárvore (balanceamento AVL)
+    int tamanho;                  // Número de pistas na subárvore (contagem e posição)
+    struct PistaNode* esquerda;   // Filho esquerdo (menor alfabeticamente)
+    struct PistaNode* direita;    // Filho direito (maior alfabeticamente)
+} PistaNode;
+
+PistaNode* criarPistaNode(Arena* arena, uint32_t pista);
+PistaNode* copiarPistaNode(Arena* arena, const PistaNode* no);
+int alturaPista(PistaNode* no);
+int tamanhoPista(PistaNode* no);
+void atualizarNo(PistaNode* no);
+PistaNode* rotacionarDireita(PistaNode* no);
+PistaNode* rotacionarEsquerda(PistaNode* no);
+PistaNode* balancearPista(PistaNode* no);
+void rebalancearCaminho(PistaNode** caminho[], int profundidade);
+PistaNode* inserirPista(Arena* arena, PistaNode* raiz, uint32_t pista);
+PistaNode* inserirPistaPersistente(Arena* arena, PistaNode* raiz, uint32_t pista);
+PistaNode* montarArvorePistas(Arena* arena, const uint32_t* pistas, int quantidade);
+void listarPistasEmOrdem(PistaNode* raiz, uint32_t* pistas);
+void buscarSuspeitosDaArvore(PistaNode* raiz, uint32_t* pistas, int* idsSuspeitos);
+int contarPistas(PistaNode* raiz);
+PistaNode* pistaNaPosicao(PistaNode* raiz, int posicao);
+int contarPistasAntes(PistaNode* raiz, const char* conteudo);
+
+#endif
@@ -0,0 +1,407 @@
+#define _POSIX_C_SOURCE 200809L  // clock_gettime e sysconf
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "resolvedor.h"
+#include "suspeitos.h"
+
+/*
+ * Função: prepararResolvedor
+ * Propósito: Calcula, em uma passada em largura, o pai de cada sala, o suspeito de
+ *            cada sala e quantos caminhos terminam em cada subárvore
+ * Parâmetros: resolvedor - resolvedor a ser preenchido
+ * Retorno: void
+ */
+void prepararResolvedor(Resolvedor* resolvedor) {
+    uint32_t n = mansao.quantidade;
+    uint32_t* ordem = (uint32_t*)malloc(n * sizeof(uint32_t));
+    resolvedor->pai = (uint32_t*)malloc(n * sizeof(uint32_t));
+    resolvedor->folhas = (uint64_t*)calloc(n, sizeof(uint64_t));
+    resolvedor->suspeitoDaSala = (int*)malloc(n * sizeof(int));
+    if (ordem == NULL || resolvedor->pai == NULL || resolvedor->folhas == NULL
+        || resolvedor->suspeitoDaSala == NULL) {
+        printf("Erro: Não foi possível alocar memória para o resolvedor.\n");
+        exit(1);
+    }
+    
+    // Ordem em largura a partir da entrada
+    uint32_t fim = ordenarEmLargura(ordem);
+    
+    // Suspeito de cada sala, consultado em lote na ordem do vetor de salas
+    uint32_t* pistas = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (pistas == NULL) {
+        printf("Erro: Não foi possível alocar memória para o resolvedor.\n");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        pistas[i] = mansao.salas[i].pista;
+    }
+    buscarSuspeitosEmLote(pistas, n, resolvedor->suspeitoDaSala);
+    free(pistas);
+    
+    resolvedor->pai[0] = SEM_SALA;
+    for (uint32_t i = 0; i < fim; i++) {
+        const Sala* sala = &mansao.salas[ordem[i]];
+        if (sala->esquerda != SEM_SALA) {
+            resolvedor->pai[sala->esquerda] = ordem[i];
+        }
+        if (sala->direita != SEM_SALA) {
+            resolvedor->pai[sala->direita] = ordem[i];
+        }
+    }
+    resolvedor->numAlcancaveis = fim;
+    
+    // Ordem inversa: cada subárvore soma os caminhos dos filhos antes do pai
+    for (uint32_t i = fim; i-- > 0; ) {
+        uint32_t id = ordem[i];
+        const Sala* sala = &mansao.salas[id];
+        if (sala->esquerda == SEM_SALA && sala->direita == SEM_SALA) {
+            resolvedor->folhas[id] = 1;
+        }
+        if (resolvedor->pai[id] != SEM_SALA) {
+            resolvedor->folhas[resolvedor->pai[id]] += resolvedor->folhas[id];
+        }
+    }
+    free(ordem);
+}
+
+/*
+ * Função: entrarNoCaminho
+ * Propósito: Acrescenta a pista de uma sala ao caminho atual (push incremental)
+ * Parâmetros: resolvedor - dados pré-calculados da mansão
+ *            estado - estado do caminho da thread
+ *            id - sala em que o caminho entra
+ * Retorno: suspeito que acabou de atingir 2 pistas (-1 se nenhum)
+ */
+static inline int entrarNoCaminho(const Resolvedor* resolvedor, EstadoCaminho* estado, uint32_t id) {
+    uint32_t pista = mansao.salas[id].pista;
+    int suspeito = resolvedor->suspeitoDaSala[id];
+    
+    // Pistas repetidas no caminho contam uma só vez (como no inventário do jogo)
+    if (pista == STRING_VAZIA || estado->vistas[pista]++ > 0 || suspeito < 0) {
+        return -1;
+    }
+    if (++estado->contagem[suspeito] == 2) {
+        estado->comDuasPistas++;
+        return suspeito;
+    }
+    return -1;
+}
+
+/*
+ * Função: sairDoCaminho
+ * Propósito: Remove a pista de uma sala do caminho atual (pop incremental)
+ * Parâmetros: resolvedor - dados pré-calculados da mansão
+ *            estado - estado do caminho da thread
+ *            id - sala de onde o caminho volta
+ * Retorno: void
+ */
+static inline void sairDoCaminho(const Resolvedor* resolvedor, EstadoCaminho* estado, uint32_t id) {
+    uint32_t pista = mansao.salas[id].pista;
+    int suspeito = resolvedor->suspeitoDaSala[id];
+    
+    if (pista == STRING_VAZIA || --estado->vistas[pista] > 0 || suspeito < 0) {
+        return;
+    }
+    if (estado->contagem[suspeito]-- == 2) {
+        estado->comDuasPistas--;
+    }
+}
+
+/*
+ * Função: caminhoAntes
+ * Propósito: Desempata dois caminhos de mesmo tamanho pela ordem dos movimentos ('e' antes
+ *            de 'd'), de modo que o resultado não dependa da numeração das salas
+ * Parâmetros: resolvedor - resolvedor com os pais das salas
+ *            a, b - salas na mesma profundidade (b pode ser SEM_SALA)
+ * Retorno: 1 se o caminho até "a" vem antes do caminho até "b", 0 caso contrário
+ */
+int caminhoAntes(const Resolvedor* resolvedor, uint32_t a, uint32_t b) {
+    if (b == SEM_SALA) {
+        return 1;
+    }
+    // Sobe pelos dois caminhos até o ancestral comum; decide a primeira bifurcação
+    while (a != b && resolvedor->pai[a] != resolvedor->pai[b]) {
+        a = resolvedor->pai[a];
+        b = resolvedor->pai[b];
+    }
+    return a != b && mansao.salas[resolvedor->pai[a]].esquerda == a;
+}
+
+/*
+ * Função: obterTarefa
+ * Propósito: Retira uma subárvore doada; espera enquanto outras threads ainda trabalham
+ * Parâmetros: resolvedor - resolvedor compartilhado
+ * Retorno: raiz da subárvore (SEM_SALA quando a busca terminou)
+ */
+uint32_t obterTarefa(Resolvedor* resolvedor) {
+    pthread_mutex_lock(&resolvedor->trava);
+    while (resolvedor->numTarefas == 0 && !resolvedor->terminado) {
+        resolvedor->ociosos++;
+        if (resolvedor->ociosos == resolvedor->numThreads) {
+            // Ninguém mais pode doar: a árvore inteira foi percorrida
+            resolvedor->terminado = 1;
+            pthread_cond_broadcast(&resolvedor->temTarefa);
+        } else {
+            atomic_store_explicit(&resolvedor->fome, resolvedor->ociosos - resolvedor->numTarefas,
+                                  memory_order_relaxed);
+            pthread_cond_wait(&resolvedor->temTarefa, &resolvedor->trava);
+        }
+        resolvedor->ociosos--;
+    }
+    
+    uint32_t raiz = SEM_SALA;
+    if (resolvedor->numTarefas > 0) {
+        raiz = resolvedor->tarefas[--resolvedor->numTarefas];
+    }
+    atomic_store_explicit(&resolvedor->fome, resolvedor->ociosos - resolvedor->numTarefas,
+                          memory_order_relaxed);
+    pthread_mutex_unlock(&resolvedor->trava);
+    return raiz;
+}
+
+/*
+ * Função: doarTrabalho
+ * Propósito: Entrega a uma thread ociosa o ramo pendente mais raso da pilha
+ *            (o maior pedaço de trabalho disponível)
+ * Parâmetros: resolvedor - resolvedor compartilhado
+ *            pilha, topo - pilha de busca da thread doadora
+ *            inicioDoavel - primeira posição da pilha que ainda pode ter ramos pendentes
+ * Retorno: void
+ */
+void doarTrabalho(Resolvedor* resolvedor, QuadroBusca* pilha, size_t topo, size_t* inicioDoavel) {
+    size_t i = *inicioDoavel < topo ? *inicioDoavel : topo;
+    while (i < topo && (pilha[i].saindo || pilha[i].sala == SEM_SALA)) {
+        i++;
+    }
+    *inicioDoavel = i;
+    if (i == topo) {
+        return;
+    }
+    
+    pthread_mutex_lock(&resolvedor->trava);
+    if (resolvedor->ociosos > resolvedor->numTarefas) {
+        resolvedor->tarefas[resolvedor->numTarefas++] = pilha[i].sala;
+        pilha[i].sala = SEM_SALA;
+        *inicioDoavel = i + 1;
+        atomic_store_explicit(&resolvedor->fome, resolvedor->ociosos - resolvedor->numTarefas,
+                              memory_order_relaxed);
+        pthread_cond_signal(&resolvedor->temTarefa);
+    }
+    pthread_mutex_unlock(&resolvedor->trava);
+}
+
+/*
+ * Função: explorarCaminhos
+ * Propósito: Laço de uma thread do resolvedor: percorre subárvores em profundidade,
+ *            mantendo os contadores do caminho com push/pop, e doa ramos sob demanda
+ * Parâmetros: argumento - resolvedor compartilhado (Resolvedor*)
+ * Retorno: NULL
+ */
+void* explorarCaminhos(void* argumento) {
+    Resolvedor* resolvedor = (Resolvedor*)argumento;
+    EstadoCaminho estado;
+    estado.vistas = (uint32_t*)calloc(strings.quantidade + 1, sizeof(uint32_t));
+    estado.contagem = (int*)calloc(suspeitos.quantidade + 1, sizeof(int));
+    estado.comDuasPistas = 0;
+    size_t capacidade = CAPACIDADE_SALAS_INICIAL;
+    QuadroBusca* pilha = (QuadroBusca*)malloc(capacidade * sizeof(QuadroBusca));
+    uint32_t* ancestrais = (uint32_t*)malloc(resolvedor->numAlcancaveis * sizeof(uint32_t));
+    if (estado.vistas == NULL || estado.contagem == NULL || pilha == NULL || ancestrais == NULL) {
+        printf("Erro: Não foi possível alocar memória para o resolvedor.\n");
+        exit(1);
+    }
+    
+    uint64_t caminhos = 0, solucionaveis = 0;
+    uint32_t melhorProfundidade = UINT32_MAX, melhorSala = SEM_SALA;
+    int melhorSuspeito = -1;
+    
+    for (uint32_t raiz = obterTarefa(resolvedor); raiz != SEM_SALA; raiz = obterTarefa(resolvedor)) {
+        // Reconstrói o estado do caminho até a subárvore recebida
+        uint32_t numAncestrais = 0;
+        for (uint32_t a = resolvedor->pai[raiz]; a != SEM_SALA; a = resolvedor->pai[a]) {
+            ancestrais[numAncestrais++] = a;
+        }
+        for (uint32_t i = numAncestrais; i-- > 0; ) {
+            entrarNoCaminho(resolvedor, &estado, ancestrais[i]);
+        }
+        
+        size_t topo = 0, inicioDoavel = 0;
+        pilha[topo++] = (QuadroBusca){raiz, numAncestrais, 0};
+        while (topo > 0) {
+            QuadroBusca quadro = pilha[--topo];
+            if (quadro.sala == SEM_SALA) {
+                continue; // Ramo doado a outra thread
+            }
+            if (quadro.saindo) {
+                sairDoCaminho(resolvedor, &estado, quadro.sala);
+                continue;
+            }
+            
+            int suspeito = entrarNoCaminho(resolvedor, &estado, quadro.sala);
+            if (estado.comDuasPistas > 0) {
+                // Caso solucionável a partir daqui: todos os caminhos abaixo também são
+                caminhos += resolvedor->folhas[quadro.sala];
+                solucionaveis += resolvedor->folhas[quadro.sala];
+                if (quadro.profundidade < melhorProfundidade
+                    || (quadro.profundidade == melhorProfundidade
+                        && caminhoAntes(resolvedor, quadro.sala, melhorSala))) {
+                    melhorProfundidade = quadro.profundidade;
+                    melhorSala = quadro.sala;
+                    melhorSuspeito = suspeito;
+                }
+                sairDoCaminho(resolvedor, &estado, quadro.sala);
+                continue;
+            }
+            
+            const Sala* sala = &mansao.salas[quadro.sala];
+            if (sala->esquerda == SEM_SALA && sala->direita == SEM_SALA) {
+                caminhos++;
+                sairDoCaminho(resolvedor, &estado, quadro.sala);
+                continue;
+            }
+            
+            if (topo + 3 > capacidade) {
+                capacidade *= 2;
+                QuadroBusca* novaPilha = (QuadroBusca*)realloc(pilha, capacidade * sizeof(QuadroBusca));
+                if (novaPilha == NULL) {
+                    printf("Erro: Não foi possível alocar memória para o resolvedor.\n");
+                    exit(1);
+                }
+                pilha = novaPilha;
+            }
+            pilha[topo++] = (QuadroBusca){quadro.sala, quadro.profundidade, 1};
+            prefetcharSala(sala->esquerda);
+            prefetcharSala(sala->direita);
+            if (sala->direita != SEM_SALA) {
+                pilha[topo++] = (QuadroBusca){sala->direita, quadro.profundidade + 1, 0};
+            }
+            if (sala->esquerda != SEM_SALA) {
+                pilha[topo++] = (QuadroBusca){sala->esquerda, quadro.profundidade + 1, 0};
+            }
+            
+            // Uma thread ociosa pediu trabalho: doa o ramo pendente mais raso
+            if (atomic_load_explicit(&resolvedor->fome, memory_order_relaxed) > 0) {
+                doarTrabalho(resolvedor, pilha, topo, &inicioDoavel);
+            }
+        }
+        
+        for (uint32_t i = 0; i < numAncestrais; i++) {
+            sairDoCaminho(resolvedor, &estado, ancestrais[i]);
+        }
+    }
+    
+    // Junta os resultados desta thread aos do resolvedor
+    pthread_mutex_lock(&resolvedor->trava);
+    resolvedor->caminhos += caminhos;
+    resolvedor->solucionaveis += solucionaveis;
+    if (melhorProfundidade < resolvedor->melhorProfundidade
+        || (melhorSala != SEM_SALA && melhorProfundidade == resolvedor->melhorProfundidade
+            && caminhoAntes(resolvedor, melhorSala, resolvedor->melhorSala))) {
+        resolvedor->melhorProfundidade = melhorProfundidade;
+        resolvedor->melhorSala = melhorSala;
+        resolvedor->melhorSuspeito = melhorSuspeito;
+    }
+    pthread_mutex_unlock(&resolvedor->trava);
+    
+    free(ancestrais);
+    free(pilha);
+    free(estado.contagem);
+    free(estado.vistas);
+    return NULL;
+}
+
+/*
+ * Função: resolverCaso
+ * Propósito: Percorre todos os caminhos da entrada até salas sem saída, em paralelo,
+ *            e informa quantos tornam o caso solucionável e o menor caminho vencedor
+ * Parâmetros: threads - threads da busca (0 = uma por núcleo)
+ * Retorno: void
+ */
+void resolverCaso(int threads) {
+    Resolvedor resolvedor;
+    memset(&resolvedor, 0, sizeof(resolvedor));
+    struct timespec inicio, fim;
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    prepararResolvedor(&resolvedor);
+    
+    if (threads <= 0) {
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    resolvedor.numThreads = threads;
+    resolvedor.tarefas = (uint32_t*)malloc(threads * sizeof(uint32_t));
+    pthread_t* pool = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    if (resolvedor.tarefas == NULL || pool == NULL) {
+        printf("Erro: Não foi possível alocar memória para o resolvedor.\n");
+        exit(1);
+    }
+    resolvedor.tarefas[resolvedor.numTarefas++] = 0;
+    atomic_init(&resolvedor.fome, 0);
+    resolvedor.melhorProfundidade = UINT32_MAX;
+    resolvedor.melhorSala = SEM_SALA;
+    resolvedor.melhorSuspeito = -1;
+    pthread_mutex_init(&resolvedor.trava, NULL);
+    pthread_cond_init(&resolvedor.temTarefa, NULL);
+    
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&pool[i], NULL, explorarCaminhos, &resolvedor) != 0) {
+            printf("Erro: Não foi possível criar as threads do resolvedor.\n");
+            exit(1);
+        }
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(pool[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    double segundos = (fim.tv_sec - inicio.tv_sec) + (fim.tv_nsec - inicio.tv_nsec) / 1e9;
+    
+    printf("========================================\n");
+    printf("    ANÁLISE DE CAMINHOS DO CASO        \n");
+    printf("========================================\n");
+    printf("Salas alcançáveis: %u\n", resolvedor.numAlcancaveis);
+    printf("Caminhos até salas sem saída: %llu\n", (unsigned long long)resolvedor.caminhos);
+    printf("Caminhos solucionáveis: %llu (%.2f%%)\n", (unsigned long long)resolvedor.solucionaveis,
+           resolvedor.caminhos > 0 ? 100.0 * resolvedor.solucionaveis / resolvedor.caminhos : 0.0);
+    
+    if (resolvedor.melhorSala == SEM_SALA) {
+        printf("Nenhum caminho permite reunir 2 pistas contra o mesmo suspeito.\n");
+    } else {
+        // Reconstrói os movimentos do caminho vencedor subindo pelos pais
+        uint32_t movimentos = resolvedor.melhorProfundidade;
+        char* roteiroVencedor = (char*)malloc(2 * movimentos + 2);
+        if (roteiroVencedor == NULL) {
+            printf("Erro: Não foi possível alocar memória para o resolvedor.\n");
+            exit(1);
+        }
+        uint32_t id = resolvedor.melhorSala;
+        for (uint32_t i = movimentos; i-- > 0; id = resolvedor.pai[id]) {
+            roteiroVencedor[2 * i] = mansao.salas[resolvedor.pai[id]].esquerda == id ? 'e' : 'd';
+            roteiroVencedor[2 * i + 1] = ' ';
+        }
+        roteiroVencedor[2 * movimentos] = 's';
+        roteiroVencedor[2 * movimentos + 1] = '\0';
+        
+        printf("Caminho vencedor mais curto: %u movimento%s até %s\n", movimentos,
+               movimentos == 1 ? "" : "s", textoDaString(mansao.nomes[resolvedor.melhorSala]));
+        printf("  Roteiro: %s\n", roteiroVencedor);
+        printf("  Suspeito com 2 pistas: %s\n", textoDaString(suspeitos.nomes[resolvedor.melhorSuspeito]));
+        free(roteiroVencedor);
+    }
+    printf("Tempo: %.3f s (%d thread%s)\n", segundos, threads, threads == 1 ? "" : "s");
+    printf("========================================\n");
+    
+    pthread_mutex_destroy(&resolvedor.trava);
+    pthread_cond_destroy(&resolvedor.temTarefa);
+    free(pool);
+    free(resolvedor.tarefas);
+    free(resolvedor.pai);
+    free(resolvedor.folhas);
+    free(resolvedor.suspeitoDaSala);
+}
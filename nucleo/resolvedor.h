@@ -0,0 +1,54 @@
+#ifndef NUCLEO_RESOLVEDOR_H
+#define NUCLEO_RESOLVEDOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "mansao.h"
+
+// Resolvedor de caminhos: a árvore é dividida em subárvores sob demanda (uma thread
+// ociosa sinaliza fome e a próxima thread ocupada doa o ramo pendente mais raso)
+typedef struct Resolvedor {
+    uint32_t* pai;                // Sala de onde se chega a cada sala (SEM_SALA na entrada)
+    uint64_t* folhas;             // Caminhos (salas sem saída) em cada subárvore
+    int* suspeitoDaSala;          // Suspeito apontado pela pista de cada sala (-1 se nenhum)
+    uint32_t numAlcancaveis;      // Salas alcançáveis a partir da entrada
+    uint32_t* tarefas;            // Subárvores doadas ainda não iniciadas
+    int numTarefas;
+    int ociosos;                  // Threads esperando por uma tarefa
+    int numThreads;
+    int terminado;                // Todas as threads ociosas sem tarefas: fim da busca
+    atomic_int fome;              // Threads ociosas ainda sem tarefa (> 0: doar trabalho)
+    pthread_mutex_t trava;        // Protege tarefas, ociosos e os resultados
+    pthread_cond_t temTarefa;
+    uint64_t caminhos;            // Caminhos da entrada até uma sala sem saída
+    uint64_t solucionaveis;       // Caminhos em que algum suspeito acumula 2 pistas
+    uint32_t melhorProfundidade;  // Menor número de movimentos até o caso ser solucionável
+    uint32_t melhorSala;          // Sala em que isso acontece (SEM_SALA se nunca)
+    int melhorSuspeito;           // Suspeito que atinge 2 pistas nessa sala
+} Resolvedor;
+
+// Estado incremental do caminho atual de uma thread do resolvedor
+typedef struct EstadoCaminho {
+    uint32_t* vistas;             // Ocorrências de cada pista no caminho (deduplicação)
+    int* contagem;                // Pistas distintas contra cada suspeito no caminho
+    int comDuasPistas;            // Suspeitos com pelo menos 2 pistas no caminho
+} EstadoCaminho;
+
+// Quadro da busca em profundidade iterativa do resolvedor
+typedef struct QuadroBusca {
+    uint32_t sala;                // Sala do quadro (SEM_SALA se foi doada a outra thread)
+    uint32_t profundidade;        // Movimentos desde a entrada
+    int saindo;                   // 1 = desfazer a sala ao voltar, 0 = entrar na sala
+} QuadroBusca;
+
+void prepararResolvedor(Resolvedor* resolvedor);
+int caminhoAntes(const Resolvedor* resolvedor, uint32_t a, uint32_t b);
+uint32_t obterTarefa(Resolvedor* resolvedor);
+void doarTrabalho(Resolvedor* resolvedor, QuadroBusca* pilha, size_t topo, size_t* inicioDoavel);
+void* explorarCaminhos(void* argumento);
+void resolverCaso(int threads);
+
+#endif
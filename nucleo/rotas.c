@@ -0,0 +1,775 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rotas.h"
+#include "suspeitos.h"
+#include "caso.h"
+
+Rotas rotas;                     // Derivadas do caso; preparadas na primeira consulta
+atomic_uint geracaoRotas;        // Geração do caso para a qual "rotas" foi preparado (0 = nenhuma)
+pthread_mutex_t travaRotas = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Função: propagarPistas
+ * Propósito: BFS de várias origens no grafo reverso a partir das salas com pista contra um
+ *            suspeito; cada sala recebe a pista mais próxima e a mais próxima entre as
+ *            demais pistas (cada sala entra na fila no máximo duas vezes). Para assim que
+ *            todas as salas do suspeito conhecem a distância até outra pista dele
+ * Parâmetros: suspeito - identificador do suspeito
+ *            distancia, pista, distanciaOutra - vetores por sala, já preenchidos com
+ *            DISTANCIA_INFINITA, STRING_VAZIA e DISTANCIA_INFINITA
+ *            fila - espaço para 2 * mansao.quantidade posições
+ *            tocadas - recebe as salas alcançadas, para limpar os vetores depois
+ * Retorno: número de salas em "tocadas"
+ */
+uint32_t propagarPistas(int suspeito, uint32_t* distancia, uint32_t* pista, uint32_t* distanciaOutra,
+                        EntradaFila* fila, uint32_t* tocadas) {
+    uint32_t base = rotas.inicioSalasSuspeito[suspeito];
+    uint32_t limite = rotas.inicioSalasSuspeito[suspeito + 1];
+    uint32_t pendentes = limite - base; // Salas do suspeito ainda sem a outra pista
+    uint32_t inicio = 0, fim = 0, alcancadas = 0;
+    
+    for (uint32_t i = base; i < limite; i++) {
+        uint32_t sala = rotas.salasSuspeito[i];
+        distancia[sala] = 0;
+        pista[sala] = mansao.salas[sala].pista;
+        tocadas[alcancadas++] = sala;
+        fila[fim++] = (EntradaFila){sala, pista[sala], 0};
+    }
+    
+    while (inicio < fim && pendentes > 0) {
+        EntradaFila atual = fila[inicio++];
+        for (uint32_t e = rotas.inicioEntradas[atual.sala]; e < rotas.inicioEntradas[atual.sala + 1]; e++) {
+            uint32_t sala = rotas.entradas[e];
+            if (distancia[sala] == DISTANCIA_INFINITA) {
+                distancia[sala] = atual.distancia + 1;
+                pista[sala] = atual.pista;
+                tocadas[alcancadas++] = sala;
+                fila[fim++] = (EntradaFila){sala, atual.pista, atual.distancia + 1};
+            } else if (distanciaOutra[sala] == DISTANCIA_INFINITA && pista[sala] != atual.pista) {
+                distanciaOutra[sala] = atual.distancia + 1;
+                if (rotas.suspeitoDaSala[sala] == suspeito) {
+                    pendentes--;
+                }
+                fila[fim++] = (EntradaFila){sala, atual.pista, atual.distancia + 1};
+            }
+        }
+    }
+    return alcancadas;
+}
+
+/*
+ * Função: compararSementes
+ * Propósito: Ordena as sementes da BFS de condenação por distância (empate: sala)
+ * Parâmetros: a, b - ponteiros para entradas da fila
+ * Retorno: negativo, zero ou positivo, no padrão do qsort
+ */
+int compararSementes(const void* a, const void* b) {
+    const EntradaFila* sementeA = (const EntradaFila*)a;
+    const EntradaFila* sementeB = (const EntradaFila*)b;
+    if (sementeA->distancia != sementeB->distancia) {
+        return sementeA->distancia < sementeB->distancia ? -1 : 1;
+    }
+    return (sementeA->sala > sementeB->sala) - (sementeA->sala < sementeB->sala);
+}
+
+/*
+ * Função: calcularCondenacao
+ * Propósito: Calcula, para cada sala, o menor número de passos até reunir 2 pistas
+ *            distintas contra um mesmo suspeito: uma BFS no grafo reverso cujas origens
+ *            (as salas com pista) já partem da distância até a outra pista (segundaPista).
+ *            As sementes ordenadas e a fila são intercaladas, então cada sala sai com a
+ *            menor distância, como em um Dijkstra sem heap
+ * Parâmetros: void
+ * Retorno: void
+ */
+void calcularCondenacao() {
+    uint32_t n = mansao.quantidade;
+    uint32_t numSementes = 0;
+    for (uint32_t id = 0; id < n; id++) {
+        numSementes += rotas.segundaPista[id] != DISTANCIA_INFINITA;
+    }
+    
+    EntradaFila* sementes = (EntradaFila*)malloc(((size_t)numSementes + 1) * sizeof(EntradaFila));
+    EntradaFila* fila = (EntradaFila*)malloc(((size_t)mansao.numSaidas + 1) * sizeof(EntradaFila));
+    if (sementes == NULL || fila == NULL) {
+        printf("Erro: Não foi possível alocar memória para as rotas.\n");
+        exit(1);
+    }
+    for (uint32_t id = 0, k = 0; id < n; id++) {
+        if (rotas.segundaPista[id] != DISTANCIA_INFINITA) {
+            sementes[k++] = (EntradaFila){id, mansao.salas[id].pista, rotas.segundaPista[id]};
+        }
+    }
+    qsort(sementes, numSementes, sizeof(EntradaFila), compararSementes);
+    
+    // Cada sala é fechada uma única vez e empilha suas entradas: a fila tem no máximo numSaidas posições
+    memset(rotas.condenacao, 0xff, n * sizeof(uint32_t));
+    uint32_t proximaSemente = 0, inicio = 0, fim = 0;
+    while (proximaSemente < numSementes || inicio < fim) {
+        EntradaFila atual;
+        if (inicio == fim || (proximaSemente < numSementes
+                              && sementes[proximaSemente].distancia <= fila[inicio].distancia)) {
+            atual = sementes[proximaSemente++];
+        } else {
+            atual = fila[inicio++];
+        }
+        if (rotas.condenacao[atual.sala] != DISTANCIA_INFINITA) {
+            continue;
+        }
+    
+        rotas.condenacao[atual.sala] = atual.distancia;
+        for (uint32_t e = rotas.inicioEntradas[atual.sala]; e < rotas.inicioEntradas[atual.sala + 1]; e++) {
+            if (rotas.condenacao[rotas.entradas[e]] == DISTANCIA_INFINITA) {
+                fila[fim++] = (EntradaFila){rotas.entradas[e], atual.pista, atual.distancia + 1};
+            }
+        }
+    }
+    
+    free(sementes);
+    free(fila);
+}
+
+/*
+ * Função: prepararRotas
+ * Propósito: Monta uma única vez o grafo reverso, as salas de cada suspeito e as respostas
+ *            por sala (segunda pista e condenação); chamada por garantirRotas
+ * Parâmetros: void
+ * Retorno: void
+ */
+void prepararRotas() {
+    uint32_t n = mansao.quantidade;
+    int numSuspeitos = suspeitos.quantidade;
+    rotas.inicioEntradas = (uint32_t*)calloc((size_t)n + 1, sizeof(uint32_t));
+    rotas.entradas = (uint32_t*)malloc(((size_t)mansao.numSaidas + 1) * sizeof(uint32_t));
+    rotas.suspeitoDaSala = (int*)malloc(n * sizeof(int));
+    rotas.inicioSalasSuspeito = (uint32_t*)calloc((size_t)numSuspeitos + 2, sizeof(uint32_t));
+    rotas.segundaPista = (uint32_t*)malloc(n * sizeof(uint32_t));
+    rotas.condenacao = (uint32_t*)malloc(n * sizeof(uint32_t));
+    rotas.salaDoNome = (uint32_t*)malloc(((size_t)strings.quantidade + 1) * sizeof(uint32_t));
+    rotas.distanciaPorSuspeito = (uint32_t**)calloc((size_t)numSuspeitos + 1, sizeof(uint32_t*));
+    uint32_t* proxima = (uint32_t*)malloc(((size_t)n + numSuspeitos + 1) * sizeof(uint32_t));
+    if (rotas.inicioEntradas == NULL || rotas.entradas == NULL || rotas.suspeitoDaSala == NULL
+        || rotas.inicioSalasSuspeito == NULL || rotas.segundaPista == NULL || rotas.condenacao == NULL
+        || rotas.salaDoNome == NULL || rotas.distanciaPorSuspeito == NULL || proxima == NULL) {
+        printf("Erro: Não foi possível alocar memória para as rotas.\n");
+        exit(1);
+    }
+    
+    // Grafo reverso: entradas de cada sala por contagem e soma de prefixos
+    for (uint32_t i = 0; i < mansao.numSaidas; i++) {
+        rotas.inicioEntradas[mansao.saidas[i] + 1]++;
+    }
+    for (uint32_t id = 0; id < n; id++) {
+        rotas.inicioEntradas[id + 1] += rotas.inicioEntradas[id];
+    }
+    memcpy(proxima, rotas.inicioEntradas, n * sizeof(uint32_t));
+    for (uint32_t id = 0; id < n; id++) {
+        const uint32_t* saidas = saidasDaSala(id);
+        for (uint32_t i = 0, grau = grauSala(id); i < grau; i++) {
+            rotas.entradas[proxima[saidas[i]]++] = id;
+        }
+    }
+    
+    // Suspeito de cada sala e salas de cada suspeito (CSR)
+    for (uint32_t id = 0; id < n; id++) {
+        proxima[id] = mansao.salas[id].pista;
+    }
+    buscarSuspeitosEmLote(proxima, n, rotas.suspeitoDaSala);
+    uint32_t comSuspeito = 0;
+    for (uint32_t id = 0; id < n; id++) {
+        if (rotas.suspeitoDaSala[id] >= 0) {
+            rotas.inicioSalasSuspeito[rotas.suspeitoDaSala[id] + 1]++;
+            comSuspeito++;
+        }
+    }
+    for (int i = 0; i < numSuspeitos; i++) {
+        rotas.inicioSalasSuspeito[i + 1] += rotas.inicioSalasSuspeito[i];
+    }
+    rotas.salasSuspeito = (uint32_t*)malloc(((size_t)comSuspeito + 1) * sizeof(uint32_t));
+    if (rotas.salasSuspeito == NULL) {
+        printf("Erro: Não foi possível alocar memória para as rotas.\n");
+        exit(1);
+    }
+    memcpy(proxima, rotas.inicioSalasSuspeito, ((size_t)numSuspeitos + 1) * sizeof(uint32_t));
+    for (uint32_t id = 0; id < n; id++) {
+        if (rotas.suspeitoDaSala[id] >= 0) {
+            rotas.salasSuspeito[proxima[rotas.suspeitoDaSala[id]]++] = id;
+        }
+    }
+    free(proxima);
+    
+    // Primeira sala de cada nome (de trás para frente: a de menor identificador fica)
+    memset(rotas.salaDoNome, 0xff, ((size_t)strings.quantidade + 1) * sizeof(uint32_t));
+    for (uint32_t id = n; id-- > 0; ) {
+        rotas.salaDoNome[mansao.nomes[id]] = id;
+    }
+    
+    // Segunda pista de cada sala com pista: uma BFS por suspeito, que para assim que as
+    // salas dele estão resolvidas; só as salas tocadas são limpas para o próximo
+    uint32_t* distancia = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint32_t* pista = (uint32_t*)calloc(n, sizeof(uint32_t));
+    uint32_t* distanciaOutra = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint32_t* tocadas = (uint32_t*)malloc(n * sizeof(uint32_t));
+    EntradaFila* fila = (EntradaFila*)malloc(2 * (size_t)n * sizeof(EntradaFila));
+    if (distancia == NULL || pista == NULL || distanciaOutra == NULL || tocadas == NULL || fila == NULL) {
+        printf("Erro: Não foi possível alocar memória para as rotas.\n");
+        exit(1);
+    }
+    memset(distancia, 0xff, n * sizeof(uint32_t));
+    memset(distanciaOutra, 0xff, n * sizeof(uint32_t));
+    memset(rotas.segundaPista, 0xff, n * sizeof(uint32_t));
+    for (int suspeito = 0; suspeito < numSuspeitos; suspeito++) {
+        uint32_t base = rotas.inicioSalasSuspeito[suspeito];
+        uint32_t limite = rotas.inicioSalasSuspeito[suspeito + 1];
+        if (limite - base < 2) {
+            continue;
+        }
+    
+        uint32_t numTocadas = propagarPistas(suspeito, distancia, pista, distanciaOutra, fila, tocadas);
+        for (uint32_t i = base; i < limite; i++) {
+            rotas.segundaPista[rotas.salasSuspeito[i]] = distanciaOutra[rotas.salasSuspeito[i]];
+        }
+        for (uint32_t i = 0; i < numTocadas; i++) {
+            distancia[tocadas[i]] = DISTANCIA_INFINITA;
+            pista[tocadas[i]] = STRING_VAZIA;
+            distanciaOutra[tocadas[i]] = DISTANCIA_INFINITA;
+        }
+    }
+    free(distancia);
+    free(pista);
+    free(distanciaOutra);
+    free(tocadas);
+    free(fila);
+    
+    calcularCondenacao();
+}
+
+/*
+ * Função: garantirRotas
+ * Propósito: Prepara as rotas do caso carregado, se ainda não foram preparadas para ele
+ *            (um novo carregarCaso muda a geração e as refaz na consulta seguinte); depois
+ *            da preparação a conferência é só uma leitura atômica
+ * Parâmetros: void
+ * Retorno: void
+ */
+void garantirRotas() {
+    if (atomic_load_explicit(&geracaoRotas, memory_order_acquire) == geracaoCaso) {
+        return;
+    }
+    
+    pthread_mutex_lock(&travaRotas);
+    if (atomic_load_explicit(&geracaoRotas, memory_order_relaxed) != geracaoCaso) {
+        prepararRotas();
+        atomic_store_explicit(&geracaoRotas, geracaoCaso, memory_order_release);
+    }
+    pthread_mutex_unlock(&travaRotas);
+}
+
+/*
+ * Função: alocarRota
+ * Propósito: Aloca o vetor de salas de uma rota (origem incluída)
+ * Parâmetros: passos - número de passos da rota
+ * Retorno: vetor com espaço para passos + 1 salas (liberado por quem chamou)
+ */
+uint32_t* alocarRota(uint32_t passos) {
+    uint32_t* salas = (uint32_t*)malloc(((size_t)passos + 1) * sizeof(uint32_t));
+    if (salas == NULL) {
+        printf("Erro: Não foi possível alocar memória para a rota.\n");
+        exit(1);
+    }
+    return salas;
+}
+
+/*
+ * Função: distanciasDoSuspeito
+ * Propósito: Obtém a distância de cada sala até a pista mais próxima contra um suspeito
+ *            (BFS de várias origens no grafo reverso), calculada na primeira consulta
+ *            sobre ele: O(salas + saídas) uma vez, depois O(1) por sala
+ * Parâmetros: suspeito - identificador do suspeito
+ * Retorno: distâncias do suspeito (somente leitura)
+ */
+const uint32_t* distanciasDoSuspeito(int suspeito) {
+    garantirRotas();
+    pthread_mutex_lock(&travaRotas);
+    
+    if (rotas.distanciaPorSuspeito[suspeito] == NULL) {
+        uint32_t n = mansao.quantidade;
+        uint32_t* distancia = (uint32_t*)malloc(n * sizeof(uint32_t));
+        uint32_t* fila = (uint32_t*)malloc(n * sizeof(uint32_t));
+        if (distancia == NULL || fila == NULL) {
+            printf("Erro: Não foi possível alocar memória para as rotas.\n");
+            exit(1);
+        }
+        
+        memset(distancia, 0xff, n * sizeof(uint32_t));
+        uint32_t inicio = 0, fim = 0;
+        for (uint32_t i = rotas.inicioSalasSuspeito[suspeito]; i < rotas.inicioSalasSuspeito[suspeito + 1]; i++) {
+            distancia[rotas.salasSuspeito[i]] = 0;
+            fila[fim++] = rotas.salasSuspeito[i];
+        }
+        while (inicio < fim) {
+            uint32_t sala = fila[inicio++];
+            for (uint32_t e = rotas.inicioEntradas[sala]; e < rotas.inicioEntradas[sala + 1]; e++) {
+                if (distancia[rotas.entradas[e]] == DISTANCIA_INFINITA) {
+                    distancia[rotas.entradas[e]] = distancia[sala] + 1;
+                    fila[fim++] = rotas.entradas[e];
+                }
+            }
+        }
+        free(fila);
+        rotas.distanciaPorSuspeito[suspeito] = distancia;
+    }
+    
+    const uint32_t* distancia = rotas.distanciaPorSuspeito[suspeito];
+    pthread_mutex_unlock(&travaRotas);
+    return distancia;
+}
+
+/*
+ * Função: tracarRotaPista
+ * Propósito: Monta a rota mais curta até uma pista contra o suspeito, descendo pelas
+ *            distâncias pré-calculadas (cada passo olha só as saídas da sala)
+ * Parâmetros: suspeito - identificador do suspeito
+ *            origem - sala de partida
+ *            passos - recebe o número de passos
+ * Retorno: salas da rota, da origem ao destino (NULL se não houver rota; liberado por quem chamou)
+ */
+uint32_t* tracarRotaPista(int suspeito, uint32_t origem, uint32_t* passos) {
+    const uint32_t* distancia = distanciasDoSuspeito(suspeito);
+    if (distancia[origem] == DISTANCIA_INFINITA) {
+        return NULL;
+    }
+    
+    uint32_t* salas = alocarRota(distancia[origem]);
+    salas[0] = origem;
+    for (uint32_t k = 1; k <= distancia[origem]; k++) {
+        const uint32_t* saidas = saidasDaSala(salas[k - 1]);
+        uint32_t i = 0;
+        while (distancia[saidas[i]] != distancia[origem] - k) {
+            i++;
+        }
+        salas[k] = saidas[i];
+    }
+    *passos = distancia[origem];
+    return salas;
+}
+
+/*
+ * Função: iniciarVisitadas
+ * Propósito: Cria uma tabela vazia de salas visitadas
+ * Parâmetros: visitadas - tabela a iniciar
+ *            capacidade - número de posições (potência de 2)
+ * Retorno: void
+ */
+void iniciarVisitadas(VisitadasBusca* visitadas, uint32_t capacidade) {
+    visitadas->salas = (uint32_t*)malloc(capacidade * sizeof(uint32_t));
+    visitadas->anteriores = (uint32_t*)malloc(capacidade * sizeof(uint32_t));
+    visitadas->ordem = (uint32_t*)malloc(capacidade * sizeof(uint32_t));
+    if (visitadas->salas == NULL || visitadas->anteriores == NULL || visitadas->ordem == NULL) {
+        printf("Erro: Não foi possível alocar memória para as rotas.\n");
+        exit(1);
+    }
+    memset(visitadas->salas, 0xff, capacidade * sizeof(uint32_t));
+    visitadas->capacidade = capacidade;
+    visitadas->quantidade = 0;
+}
+
+/*
+ * Função: posicaoVisitada
+ * Propósito: Localiza a posição de uma sala na tabela (hash multiplicativo, sondagem linear)
+ * Parâmetros: visitadas - tabela de salas visitadas
+ *            sala - sala procurada
+ * Retorno: posição da sala ou da posição livre onde ela entraria
+ */
+uint32_t posicaoVisitada(const VisitadasBusca* visitadas, uint32_t sala) {
+    uint32_t mascara = visitadas->capacidade - 1;
+    uint32_t indice = (sala * 2654435761u) & mascara;
+    while (visitadas->salas[indice] != SEM_SALA && visitadas->salas[indice] != sala) {
+        indice = (indice + 1) & mascara;
+    }
+    return indice;
+}
+
+/*
+ * Função: visitarSala
+ * Propósito: Marca uma sala como visitada, dobrando a tabela quando ela passa de meio cheia
+ * Parâmetros: visitadas - tabela de salas visitadas
+ *            sala - sala alcançada
+ *            anterior - sala de onde ela foi alcançada
+ * Retorno: 1 se a sala ainda não tinha sido visitada, 0 caso contrário
+ */
+int visitarSala(VisitadasBusca* visitadas, uint32_t sala, uint32_t anterior) {
+    uint32_t indice = posicaoVisitada(visitadas, sala);
+    if (visitadas->salas[indice] == sala) {
+        return 0;
+    }
+    
+    if (2 * (visitadas->quantidade + 1) > visitadas->capacidade) {
+        VisitadasBusca maior;
+        iniciarVisitadas(&maior, 2 * visitadas->capacidade);
+        for (uint32_t i = 0; i < visitadas->quantidade; i++) {
+            uint32_t antiga = posicaoVisitada(visitadas, visitadas->ordem[i]);
+            uint32_t nova = posicaoVisitada(&maior, visitadas->ordem[i]);
+            maior.salas[nova] = visitadas->ordem[i];
+            maior.anteriores[nova] = visitadas->anteriores[antiga];
+        }
+        memcpy(maior.ordem, visitadas->ordem, visitadas->quantidade * sizeof(uint32_t));
+        maior.quantidade = visitadas->quantidade;
+        liberarVisitadas(visitadas);
+        *visitadas = maior;
+        indice = posicaoVisitada(visitadas, sala);
+    }
+    visitadas->salas[indice] = sala;
+    visitadas->anteriores[indice] = anterior;
+    visitadas->ordem[visitadas->quantidade++] = sala;
+    return 1;
+}
+
+/*
+ * Função: liberarVisitadas
+ * Propósito: Libera uma tabela de salas visitadas
+ * Parâmetros: visitadas - tabela a liberar
+ * Retorno: void
+ */
+void liberarVisitadas(VisitadasBusca* visitadas) {
+    free(visitadas->salas);
+    free(visitadas->anteriores);
+    free(visitadas->ordem);
+}
+
+/*
+ * Função: buscarOutraPista
+ * Propósito: BFS a partir da origem, limitada em profundidade, até a sala mais próxima
+ *            com uma pista contra o suspeito diferente de "pistaConhecida". Só visita as
+ *            salas até o limite, marcadas em uma tabela da própria chamada, então
+ *            consultas paralelas não disputam trava nem vetores do caso
+ * Parâmetros: origem - sala de partida
+ *            suspeito - suspeito procurado
+ *            pistaConhecida - pista que não conta
+ *            limite - profundidade máxima da busca (finita)
+ *            passos - recebe o número de passos
+ * Retorno: salas da rota (NULL se não houver sala até o limite; liberado por quem chamou)
+ */
+uint32_t* buscarOutraPista(uint32_t origem, int suspeito, uint32_t pistaConhecida, uint32_t limite,
+                           uint32_t* passos) {
+    VisitadasBusca visitadas;
+    iniciarVisitadas(&visitadas, CAPACIDADE_VISITADAS_INICIAL);
+    
+    // BFS por níveis; a ordem de visita da tabela é a fila
+    uint32_t inicio = 0, fimDoNivel, nivel = 0, alvo = SEM_SALA;
+    visitarSala(&visitadas, origem, SEM_SALA);
+    while (alvo == SEM_SALA && inicio < visitadas.quantidade && nivel < limite) {
+        nivel++;
+        for (fimDoNivel = visitadas.quantidade; alvo == SEM_SALA && inicio < fimDoNivel; inicio++) {
+            uint32_t sala = visitadas.ordem[inicio];
+            const uint32_t* saidas = saidasDaSala(sala);
+            for (uint32_t i = 0, grau = grauSala(sala); i < grau; i++) {
+                uint32_t vizinha = saidas[i];
+                if (!visitarSala(&visitadas, vizinha, sala)) {
+                    continue;
+                }
+                if (rotas.suspeitoDaSala[vizinha] == suspeito && mansao.salas[vizinha].pista != pistaConhecida) {
+                    alvo = vizinha;
+                    break;
+                }
+            }
+        }
+    }
+    
+    uint32_t* salas = NULL;
+    if (alvo != SEM_SALA) {
+        salas = alocarRota(nivel);
+        for (uint32_t k = nivel + 1, sala = alvo; k-- > 0;
+             sala = visitadas.anteriores[posicaoVisitada(&visitadas, sala)]) {
+            salas[k] = sala;
+        }
+        *passos = nivel;
+    }
+    liberarVisitadas(&visitadas);
+    return salas;
+}
+
+/*
+ * Função: tracarRotaCondenacao
+ * Propósito: Monta a rota mais curta que reúne 2 pistas distintas contra um mesmo suspeito
+ *            (a pista da origem conta): desce pela condenação até a sala da primeira
+ *            pista e dela segue até a outra pista mais próxima do mesmo suspeito
+ * Parâmetros: origem - sala de partida
+ *            passos - recebe o número de passos
+ *            suspeito - recebe o suspeito incriminado
+ * Retorno: salas da rota, da origem ao destino (NULL se não houver rota; liberado por quem chamou)
+ */
+uint32_t* tracarRotaCondenacao(uint32_t origem, uint32_t* passos, int* suspeito) {
+    garantirRotas();
+    uint32_t distancia = rotas.condenacao[origem];
+    if (distancia == DISTANCIA_INFINITA) {
+        return NULL;
+    }
+    
+    uint32_t* salas = alocarRota(distancia);
+    uint32_t k = 0;
+    salas[0] = origem;
+    while (rotas.segundaPista[salas[k]] != distancia - k) {
+        const uint32_t* saidas = saidasDaSala(salas[k]);
+        uint32_t i = 0;
+        while (rotas.condenacao[saidas[i]] != distancia - k - 1) {
+            i++;
+        }
+        salas[++k] = saidas[i];
+    }
+    
+    // A segunda pista está exatamente a segundaPista passos da primeira
+    uint32_t primeira = salas[k];
+    uint32_t restantes = 0;
+    *suspeito = rotas.suspeitoDaSala[primeira];
+    uint32_t* resto = buscarOutraPista(primeira, *suspeito, mansao.salas[primeira].pista,
+                                       rotas.segundaPista[primeira], &restantes);
+    memcpy(&salas[k + 1], &resto[1], restantes * sizeof(uint32_t));
+    free(resto);
+    *passos = distancia;
+    return salas;
+}
+
+/*
+ * Função: tracarRotaEntreSalas
+ * Propósito: Monta a rota mais curta entre duas salas; a BFS da origem fica em cache,
+ *            então consultas seguidas a partir da mesma sala custam só o tamanho da rota
+ * Parâmetros: origem - sala de partida
+ *            destino - sala de chegada
+ *            passos - recebe o número de passos
+ * Retorno: salas da rota, da origem ao destino (NULL se inalcançável; liberado por quem chamou)
+ */
+uint32_t* tracarRotaEntreSalas(uint32_t origem, uint32_t destino, uint32_t* passos) {
+    uint32_t n = mansao.quantidade;
+    pthread_mutex_lock(&travaRotas);
+    
+    if (rotas.distanciaDaOrigem == NULL || rotas.origem != origem) {
+        uint32_t* fila = (uint32_t*)malloc(n * sizeof(uint32_t));
+        if (rotas.distanciaDaOrigem == NULL) {
+            rotas.distanciaDaOrigem = (uint32_t*)malloc(n * sizeof(uint32_t));
+            rotas.anterior = (uint32_t*)malloc(n * sizeof(uint32_t));
+        }
+        if (fila == NULL || rotas.distanciaDaOrigem == NULL || rotas.anterior == NULL) {
+            printf("Erro: Não foi possível alocar memória para as rotas.\n");
+            exit(1);
+        }
+        
+        memset(rotas.distanciaDaOrigem, 0xff, n * sizeof(uint32_t));
+        uint32_t inicio = 0, fim = 0;
+        rotas.distanciaDaOrigem[origem] = 0;
+        rotas.anterior[origem] = SEM_SALA;
+        fila[fim++] = origem;
+        while (inicio < fim) {
+            uint32_t sala = fila[inicio++];
+            const uint32_t* saidas = saidasDaSala(sala);
+            for (uint32_t i = 0, grau = grauSala(sala); i < grau; i++) {
+                if (rotas.distanciaDaOrigem[saidas[i]] == DISTANCIA_INFINITA) {
+                    rotas.distanciaDaOrigem[saidas[i]] = rotas.distanciaDaOrigem[sala] + 1;
+                    rotas.anterior[saidas[i]] = sala;
+                    fila[fim++] = saidas[i];
+                }
+            }
+        }
+        free(fila);
+        rotas.origem = origem;
+    }
+    
+    uint32_t distancia = rotas.distanciaDaOrigem[destino];
+    uint32_t* salas = NULL;
+    if (distancia != DISTANCIA_INFINITA) {
+        salas = alocarRota(distancia);
+        for (uint32_t k = distancia + 1, sala = destino; k-- > 0; sala = rotas.anterior[sala]) {
+            salas[k] = sala;
+        }
+        *passos = distancia;
+    }
+    
+    pthread_mutex_unlock(&travaRotas);
+    return salas;
+}
+
+/*
+ * Função: descreverJogada
+ * Propósito: Escreve a jogada que leva de uma sala a uma vizinha ("e", "d" ou o número da passagem)
+ * Parâmetros: origem - sala de partida
+ *            destino - uma das saídas da origem
+ *            texto - recebe a jogada
+ * Retorno: void
+ */
+void descreverJogada(uint32_t origem, uint32_t destino, char texto[TAMANHO_JOGADA]) {
+    const Sala* sala = &mansao.salas[origem];
+    if (sala->esquerda == destino) {
+        strcpy(texto, "e");
+        return;
+    }
+    if (sala->direita == destino) {
+        strcpy(texto, "d");
+        return;
+    }
+    
+    const uint32_t* saidas = saidasDaSala(origem);
+    uint32_t saidasDaArvore = (sala->esquerda != SEM_SALA) + (sala->direita != SEM_SALA);
+    uint32_t i = saidasDaArvore;
+    while (saidas[i] != destino) {
+        i++;
+    }
+    snprintf(texto, TAMANHO_JOGADA, "%u", i - saidasDaArvore + 1);
+}
+
+/*
+ * Função: erroConsulta
+ * Propósito: Informa um erro em uma linha de consultas e encerra o programa
+ * Parâmetros: numeroLinha - linha onde o erro foi encontrado
+ *            mensagem - descrição do problema
+ * Retorno: não retorna
+ */
+void erroConsulta(long numeroLinha, const char* mensagem) {
+    printf("Erro: linha %ld das consultas: %s.\n", numeroLinha, mensagem);
+    exit(1);
+}
+
+/*
+ * Função: salaPorNome
+ * Propósito: Localiza a sala de uma consulta pelo nome (a primeira, se houver repetidos)
+ * Parâmetros: nome - nome da sala
+ *            numeroLinha - linha atual (para mensagens de erro)
+ * Retorno: identificador da sala (encerra o programa se não existir)
+ */
+uint32_t salaPorNome(const char* nome, long numeroLinha) {
+    uint32_t id = buscarString(nome);
+    if (id == STRING_INEXISTENTE || rotas.salaDoNome[id] == SEM_SALA) {
+        erroConsulta(numeroLinha, "sala desconhecida");
+    }
+    return rotas.salaDoNome[id];
+}
+
+/*
+ * Função: imprimirRota
+ * Propósito: Escreve o resultado de uma consulta: passos, jogadas (prontas para --lote)
+ *            e nomes das salas
+ * Parâmetros: salas - rota da origem ao destino (NULL se inalcançável; é liberada)
+ *            passos - número de passos da rota
+ * Retorno: void
+ */
+void imprimirRota(const uint32_t* salas, uint32_t passos) {
+    if (salas == NULL) {
+        printf("-\n");
+        return;
+    }
+    
+    printf("%u\t", passos);
+    for (uint32_t i = 0; i < passos; i++) {
+        char jogada[TAMANHO_JOGADA];
+        descreverJogada(salas[i], salas[i + 1], jogada);
+        printf(i > 0 ? " %s" : "%s", jogada);
+    }
+    printf("\t");
+    for (uint32_t i = 0; i <= passos; i++) {
+        printf(i > 0 ? " > %s" : "%s", textoDaString(mansao.nomes[salas[i]]));
+    }
+    printf("\n");
+    free((void*)salas);
+}
+
+/*
+ * Função: responderConsultas
+ * Propósito: Responde uma consulta de rota por linha (campos separados por TAB):
+ *            P sala suspeito - pista mais próxima contra o suspeito
+ *            C sala          - menor rota que incrimina algum suspeito
+ *            A origem destino - menor rota entre duas salas
+ * Parâmetros: consultas - texto das consultas (é modificado)
+ * Retorno: void
+ */
+void responderConsultas(char* consultas) {
+    garantirRotas();
+    long numeroLinha = 0;
+    char* campos[MAX_CAMPOS_CASO] = {NULL};
+    
+    for (char* linha = consultas; linha != NULL && *linha != '\0'; ) {
+        char* proximaLinha = strchr(linha, '\n');
+        if (proximaLinha != NULL) {
+            *proximaLinha++ = '\0';
+        }
+        numeroLinha++;
+        int numCampos = separarCampos(linha, campos);
+        linha = proximaLinha;
+    
+        // Linhas vazias e comentários são ignorados
+        if (campos[0][0] == '\0' || campos[0][0] == '#') {
+            continue;
+        }
+        if (campos[0][1] != '\0') {
+            erroConsulta(numeroLinha, "tipo de consulta desconhecido");
+        }
+    
+        uint32_t passos = 0;
+        switch (campos[0][0]) {
+            case 'P': {
+                if (numCampos < 3) {
+                    erroConsulta(numeroLinha, "consulta de pista incompleta");
+                }
+                uint32_t sala = salaPorNome(campos[1], numeroLinha);
+                int suspeito = buscarSuspeito(buscarString(campos[2]));
+                if (suspeito < 0) {
+                    erroConsulta(numeroLinha, "suspeito desconhecido");
+                }
+                uint32_t* salas = tracarRotaPista(suspeito, sala, &passos);
+                printf("P\t%s\t%s\t", campos[1], campos[2]);
+                imprimirRota(salas, passos);
+                break;
+            }
+            case 'C': {
+                if (numCampos < 2) {
+                    erroConsulta(numeroLinha, "consulta de condenação incompleta");
+                }
+                int suspeito = -1;
+                uint32_t* salas = tracarRotaCondenacao(salaPorNome(campos[1], numeroLinha), &passos, &suspeito);
+                printf("C\t%s\t%s\t", campos[1], suspeito >= 0 ? textoDaString(suspeitos.nomes[suspeito]) : "-");
+                imprimirRota(salas, passos);
+                break;
+            }
+            case 'A': {
+                if (numCampos < 3) {
+                    erroConsulta(numeroLinha, "consulta de rota incompleta");
+                }
+                uint32_t origem = salaPorNome(campos[1], numeroLinha);
+                uint32_t destino = salaPorNome(campos[2], numeroLinha);
+                uint32_t* salas = tracarRotaEntreSalas(origem, destino, &passos);
+                printf("A\t%s\t%s\t", campos[1], campos[2]);
+                imprimirRota(salas, passos);
+                break;
+            }
+            default:
+                erroConsulta(numeroLinha, "tipo de consulta desconhecido");
+        }
+    }
+}
+
+/*
+ * Função: liberarRotas
+ * Propósito: Libera o motor de rotas (só existe se alguma rota foi consultada)
+ * Parâmetros: void
+ * Retorno: void
+ */
+void liberarRotas() {
+    if (rotas.distanciaPorSuspeito != NULL) {
+        for (int i = 0; i < suspeitos.quantidade; i++) {
+            free(rotas.distanciaPorSuspeito[i]);
+        }
+    }
+    free(rotas.distanciaPorSuspeito);
+    free(rotas.inicioEntradas);
+    free(rotas.entradas);
+    free(rotas.suspeitoDaSala);
+    free(rotas.inicioSalasSuspeito);
+    free(rotas.salasSuspeito);
+    free(rotas.segundaPista);
+    free(rotas.condenacao);
+    free(rotas.salaDoNome);
+    free(rotas.distanciaDaOrigem);
+    free(rotas.anterior);
+    memset(&rotas, 0, sizeof(rotas));
+    atomic_store_explicit(&geracaoRotas, 0, memory_order_relaxed);
+}
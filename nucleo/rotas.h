@@ -0,0 +1,77 @@
+#ifndef NUCLEO_ROTAS_H
+#define NUCLEO_ROTAS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "mansao.h"
+
+#define DISTANCIA_INFINITA UINT32_MAX    // Alvo inalcançável a partir da sala
+#define TAMANHO_JOGADA 12                // Texto de uma jogada: "e", "d" ou o número da passagem
+#define CAPACIDADE_VISITADAS_INICIAL 64  // Posições iniciais da tabela de salas de uma busca limitada
+
+// Posição da fila da BFS: sala alcançada, pista que a alcançou e distância até ela
+typedef struct EntradaFila {
+    uint32_t sala;
+    uint32_t pista;
+    uint32_t distancia;
+} EntradaFila;
+
+// Salas visitadas por uma busca limitada (endereçamento aberto, sondagem linear): custa o
+// número de salas visitadas, não o tamanho da mansão, e pertence à chamada (sem trava)
+typedef struct VisitadasBusca {
+    uint32_t* salas;              // Chave de cada posição (SEM_SALA = livre)
+    uint32_t* anteriores;         // Sala anterior no caminho mínimo desde a origem
+    uint32_t* ordem;              // Salas na ordem da visita (a fila da BFS)
+    uint32_t capacidade;          // Potência de 2; a tabela fica no máximo meio cheia
+    uint32_t quantidade;          // Salas visitadas
+} VisitadasBusca;
+
+// Motor de consultas de rotas sobre o grafo da mansão. O grafo reverso e as respostas
+// por sala são calculados na primeira consulta; os demais caches, sob demanda
+typedef struct Rotas {
+    uint32_t* inicioEntradas;     // Grafo reverso (CSR): salas com saída para id em
+    uint32_t* entradas;           //   entradas[inicioEntradas[id] .. inicioEntradas[id + 1])
+    int* suspeitoDaSala;          // Suspeito apontado pela pista de cada sala (-1 se nenhum)
+    uint32_t* inicioSalasSuspeito; // Salas com pista contra cada suspeito (CSR, em ordem de sala)
+    uint32_t* salasSuspeito;
+    uint32_t* segundaPista;       // Em uma sala com pista: passos até outra pista do mesmo suspeito
+    uint32_t* condenacao;         // Passos até reunir 2 pistas distintas contra um mesmo suspeito
+    uint32_t* salaDoNome;         // Primeira sala com cada nome, indexada pela string
+    uint32_t** distanciaPorSuspeito; // Passos até uma pista de cada suspeito (sob demanda)
+    uint32_t origem;              // Origem da última rota entre duas salas
+    uint32_t* distanciaDaOrigem;  // Passos desde "origem" até cada sala (NULL antes da primeira)
+    uint32_t* anterior;           // Sala anterior no caminho mínimo desde "origem"
+} Rotas;
+
+extern Rotas rotas;
+extern atomic_uint geracaoRotas;
+extern pthread_mutex_t travaRotas;
+
+uint32_t propagarPistas(int suspeito, uint32_t* distancia, uint32_t* pista, uint32_t* distanciaOutra,
+                        EntradaFila* fila, uint32_t* tocadas);
+int compararSementes(const void* a, const void* b);
+void calcularCondenacao();
+void prepararRotas();
+void garantirRotas();
+uint32_t* alocarRota(uint32_t passos);
+const uint32_t* distanciasDoSuspeito(int suspeito);
+uint32_t* tracarRotaPista(int suspeito, uint32_t origem, uint32_t* passos);
+void iniciarVisitadas(VisitadasBusca* visitadas, uint32_t capacidade);
+uint32_t posicaoVisitada(const VisitadasBusca* visitadas, uint32_t sala);
+int visitarSala(VisitadasBusca* visitadas, uint32_t sala, uint32_t anterior);
+void liberarVisitadas(VisitadasBusca* visitadas);
+uint32_t* buscarOutraPista(uint32_t origem, int suspeito, uint32_t pistaConhecida, uint32_t limite,
+                           uint32_t* passos);
+uint32_t* tracarRotaCondenacao(uint32_t origem, uint32_t* passos, int* suspeito);
+uint32_t* tracarRotaEntreSalas(uint32_t origem, uint32_t destino, uint32_t* passos);
+void descreverJogada(uint32_t origem, uint32_t destino, char texto[TAMANHO_JOGADA]);
+void erroConsulta(long numeroLinha, const char* mensagem);
+uint32_t salaPorNome(const char* nome, long numeroLinha);
+void imprimirRota(const uint32_t* salas, uint32_t passos);
+void responderConsultas(char* consultas);
+void liberarRotas();
+
+#endif
@@ -0,0 +1,466 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "salvamento.h"
+#include "suspeitos.h"
+#include "busca.h"
+
+/*
+ * Função: escreverVarint
+ * Propósito: Grava um inteiro sem sinal em varint (7 bits por byte, o bit alto indica
+ *            que há mais bytes)
+ * Parâmetros: destino - buffer com pelo menos MAX_BYTES_VARINT bytes livres
+ *            valor - inteiro a ser gravado
+ * Retorno: número de bytes escritos
+ */
+size_t escreverVarint(uint8_t* destino, uint64_t valor) {
+    size_t bytes = 0;
+    while (valor >= 0x80) {
+        destino[bytes++] = (uint8_t)(valor | 0x80);
+        valor >>= 7;
+    }
+    destino[bytes++] = (uint8_t)valor;
+    return bytes;
+}
+
+/*
+ * Função: lerVarint
+ * Propósito: Lê um varint e avança a posição de leitura
+ * Parâmetros: posicao - posição de leitura (avançada para depois do varint)
+ *            fim - fim dos dados disponíveis
+ *            valor - recebe o inteiro lido
+ * Retorno: 1 em caso de sucesso, 0 se os dados acabaram ou o varint é longo demais
+ */
+int lerVarint(const uint8_t** posicao, const uint8_t* fim, uint64_t* valor) {
+    uint64_t resultado = 0;
+    for (int deslocamento = 0; deslocamento < 64 && *posicao < fim; deslocamento += 7) {
+        uint8_t byte = *(*posicao)++;
+        resultado |= (uint64_t)(byte & 0x7F) << deslocamento;
+        if ((byte & 0x80) == 0) {
+            *valor = resultado;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Função: bitsPorSaida
+ * Propósito: Calcula quantos bits o salvamento usa para a saída tomada em uma sala
+ * Parâmetros: grau - número de saídas da sala
+ * Retorno: ceil(log2(grau)) (0 para salas com uma saída só)
+ */
+uint32_t bitsPorSaida(uint32_t grau) {
+    return grau > 1 ? 32 - (uint32_t)__builtin_clz(grau - 1) : 0;
+}
+
+/*
+ * Função: lerSaidaDoCaminho
+ * Propósito: Lê a saída tomada em um passo do caminho salvo (bits contíguos, o menos
+ *            significativo primeiro)
+ * Parâmetros: caminho - bits do caminho
+ *            bit - posição do primeiro bit do passo; avança para o passo seguinte
+ *            largura - bits do passo (bitsPorSaida do grau da sala)
+ * Retorno: índice da saída tomada
+ */
+uint32_t lerSaidaDoCaminho(const uint8_t* caminho, uint64_t* bit, uint32_t largura) {
+    uint32_t saida = 0;
+    for (uint32_t b = 0; b < largura; b++, (*bit)++) {
+        saida |= (uint32_t)((caminho[*bit / 8] >> (*bit % 8)) & 1) << b;
+    }
+    return saida;
+}
+
+/*
+ * Função: compararIdentificadores
+ * Propósito: Ordena identificadores de pista em ordem crescente (qsort)
+ * Parâmetros: a, b - ponteiros para identificadores
+ * Retorno: negativo, zero ou positivo, no padrão do qsort
+ */
+int compararIdentificadores(const void* a, const void* b) {
+    uint32_t idA = *(const uint32_t*)a;
+    uint32_t idB = *(const uint32_t*)b;
+    return (idA > idB) - (idA < idB);
+}
+
+/*
+ * Função: compararTextosPistas
+ * Propósito: Ordena identificadores de pista pela ordem alfabética dos textos (qsort)
+ * Parâmetros: a, b - ponteiros para identificadores
+ * Retorno: negativo, zero ou positivo, no padrão do qsort
+ */
+int compararTextosPistas(const void* a, const void* b) {
+    return strcmp(textoDaString(*(const uint32_t*)a), textoDaString(*(const uint32_t*)b));
+}
+
+/*
+ * Função: esvaziarSessao
+ * Propósito: Devolve a sessão ao estado inicial (entrada da mansão, sem pistas nem passos),
+ *            mantendo o nível, a saída e o roteiro
+ * Parâmetros: sessao - sessão a ser esvaziada
+ * Retorno: void
+ */
+void esvaziarSessao(Sessao* sessao) {
+    liberarArena(&sessao->arena);
+    sessao->raizPistas = NULL;
+    zerarContadores(sessao);
+    sessao->sala = 0;
+    memset(sessao->visitadas, 0, ((size_t)mansao.quantidade + 63) / 64 * sizeof(uint64_t));
+    sessao->numHistorico = 0;
+    free(sessao->caminhoRetomado);
+    sessao->caminhoRetomado = NULL;
+    sessao->bitsRetomados = 0;
+    sessao->passosRetomados = 0;
+    liberarBuscaSessao(sessao);
+}
+
+/*
+ * Função: codificarSessao
+ * Propósito: Codifica o estado de uma investigação (caminho percorrido e pistas coletadas)
+ *            no formato compacto de salvamento
+ * Parâmetros: sessao - investigação em andamento
+ *            tamanho - recebe o tamanho do resultado em bytes
+ * Retorno: buffer com a investigação codificada (liberado por quem chamou)
+ */
+uint8_t* codificarSessao(Sessao* sessao, size_t* tamanho) {
+    int numPistas = contarPistas(sessao->raizPistas);
+    uint32_t* pistas = (uint32_t*)malloc(((size_t)numPistas + 1) * sizeof(uint32_t));
+    if (pistas == NULL) {
+        printf("Erro: Não foi possível alocar memória para salvar a investigação.\n");
+        exit(1);
+    }
+    if (numPistas > 0) {
+        listarPistasEmOrdem(sessao->raizPistas, pistas);
+    }
+    qsort(pistas, numPistas, sizeof(uint32_t), compararIdentificadores);
+    
+    // Escolhe a codificação menor: diferenças em varints ou uma posição por string
+    uint8_t rascunho[MAX_BYTES_VARINT];
+    size_t bytesDiferencas = 0;
+    for (int i = 0; i < numPistas; i++) {
+        bytesDiferencas += escreverVarint(rascunho, pistas[i] - (i > 0 ? pistas[i - 1] : 0));
+    }
+    size_t bytesMapa = ((size_t)strings.quantidade + 7) / 8;
+    int mapaDeBits = bytesMapa < bytesDiferencas;
+    
+    uint64_t bitsCaminho = sessao->bitsRetomados;
+    for (uint32_t i = 0; i < sessao->numHistorico; i++) {
+        bitsCaminho += bitsPorSaida(grauSala(sessao->historico[i].sala));
+    }
+    size_t bytesCaminho = (size_t)((bitsCaminho + 7) / 8);
+    size_t capacidade = 6 + 5 * MAX_BYTES_VARINT + bytesCaminho + (mapaDeBits ? bytesMapa : bytesDiferencas);
+    uint8_t* dados = (uint8_t*)malloc(capacidade);
+    if (dados == NULL) {
+        printf("Erro: Não foi possível alocar memória para salvar a investigação.\n");
+        exit(1);
+    }
+    
+    memcpy(dados, MAGICO_SALVAMENTO, 4);
+    dados[4] = VERSAO_SALVAMENTO;
+    dados[5] = mapaDeBits ? SALVAMENTO_MAPA_DE_BITS : 0;
+    size_t usado = 6;
+    usado += escreverVarint(dados + usado, mansao.quantidade);
+    usado += escreverVarint(dados + usado, strings.quantidade);
+    usado += escreverVarint(dados + usado, (uint64_t)suspeitos.quantidade);
+    
+    // Saídas tomadas, em bits contíguos (o bit menos significativo primeiro): as do
+    // caminho retomado que não foi refeito e depois as do histórico
+    usado += escreverVarint(dados + usado, (uint64_t)sessao->passosRetomados + sessao->numHistorico);
+    memset(dados + usado, 0, bytesCaminho);
+    uint64_t bit = 0;
+    for (; bit < sessao->bitsRetomados; bit++) {
+        dados[usado + bit / 8] |= (uint8_t)(((sessao->caminhoRetomado[bit / 8] >> (bit % 8)) & 1) << (bit % 8));
+    }
+    for (uint32_t i = 0; i < sessao->numHistorico; i++) {
+        uint32_t largura = bitsPorSaida(grauSala(sessao->historico[i].sala));
+        for (uint32_t b = 0; b < largura; b++, bit++) {
+            dados[usado + bit / 8] |= (uint8_t)(((sessao->historico[i].saida >> b) & 1) << (bit % 8));
+        }
+    }
+    usado += bytesCaminho;
+    
+    usado += escreverVarint(dados + usado, (uint64_t)numPistas);
+    if (mapaDeBits) {
+        memset(dados + usado, 0, bytesMapa);
+        for (int i = 0; i < numPistas; i++) {
+            dados[usado + pistas[i] / 8] |= (uint8_t)(1u << (pistas[i] % 8));
+        }
+        usado += bytesMapa;
+    } else {
+        for (int i = 0; i < numPistas; i++) {
+            usado += escreverVarint(dados + usado, pistas[i] - (i > 0 ? pistas[i - 1] : 0));
+        }
+    }
+    
+    free(pistas);
+    *tamanho = usado;
+    return dados;
+}
+
+/*
+ * Função: decodificarSessao
+ * Propósito: Restaura uma investigação salva sobre o caso carregado, sem repetir as
+ *            jogadas: o inventário é montado das pistas salvas em O(pistas) (mais a
+ *            ordenação) e o caminho só marca as visitas e confere as pistas
+ * Parâmetros: sessao - sessão iniciada (seu estado é substituído)
+ *            dados - investigação codificada por codificarSessao
+ *            tamanho - tamanho dos dados em bytes
+ * Retorno: 1 em caso de sucesso, 0 se os dados são inválidos ou de outro caso
+ *          (a sessão fica inalterada ou, se o inventário não confere, vazia)
+ */
+int decodificarSessao(Sessao* sessao, const uint8_t* dados, size_t tamanho) {
+    uint64_t numSalas, numStrings, numSuspeitos, passos, numPistas;
+    
+    if (tamanho < 6 || memcmp(dados, MAGICO_SALVAMENTO, 4) != 0 || dados[4] != VERSAO_SALVAMENTO
+        || (dados[5] & ~SALVAMENTO_MAPA_DE_BITS) != 0) {
+        return 0;
+    }
+    int mapaDeBits = (dados[5] & SALVAMENTO_MAPA_DE_BITS) != 0;
+    const uint8_t* posicao = dados + 6;
+    const uint8_t* fim = dados + tamanho;
+    
+    // O salvamento só vale para o mesmo caso (os identificadores se referem a ele)
+    if (!lerVarint(&posicao, fim, &numSalas) || !lerVarint(&posicao, fim, &numStrings)
+        || !lerVarint(&posicao, fim, &numSuspeitos) || numSalas != mansao.quantidade
+        || numStrings != strings.quantidade || numSuspeitos != (uint64_t)suspeitos.quantidade) {
+        return 0;
+    }
+    
+    // Segue o caminho desde a entrada: cada saída precisa existir na mansão
+    if (!lerVarint(&posicao, fim, &passos) || passos >= UINT32_MAX) {
+        return 0;
+    }
+    const uint8_t* caminho = posicao;
+    uint64_t bitsDisponiveis = (uint64_t)(fim - posicao) * 8, bit = 0;
+    uint32_t sala = 0;
+    for (uint64_t i = 0; i < passos; i++) {
+        uint32_t grau = grauSala(sala), largura = bitsPorSaida(grau);
+        if (grau == 0 || largura > bitsDisponiveis - bit) {
+            return 0;
+        }
+        uint32_t saida = lerSaidaDoCaminho(caminho, &bit, largura);
+        if (saida >= grau) {
+            return 0;
+        }
+        sala = saidasDaSala(sala)[saida];
+    }
+    uint64_t bitsCaminho = bit;
+    posicao += (bitsCaminho + 7) / 8;
+    
+    // Pistas coletadas, em ordem crescente de identificador
+    if (!lerVarint(&posicao, fim, &numPistas) || numPistas >= numStrings) {
+        return 0;
+    }
+    uint32_t* pistas = (uint32_t*)malloc((numPistas + 1) * sizeof(uint32_t));
+    if (pistas == NULL) {
+        printf("Erro: Não foi possível alocar memória para restaurar a investigação.\n");
+        exit(1);
+    }
+    uint64_t lidas = 0;
+    if (mapaDeBits) {
+        size_t bytesMapa = (numStrings + 7) / 8;
+        if (bytesMapa > (size_t)(fim - posicao)) {
+            free(pistas);
+            return 0;
+        }
+        for (size_t b = 0; b < bytesMapa; b++) {
+            for (unsigned bits = posicao[b]; bits != 0; bits &= bits - 1) {
+                uint64_t id = b * 8 + (uint64_t)__builtin_ctz(bits);
+                if (id >= numStrings || id == STRING_VAZIA || lidas == numPistas) {
+                    free(pistas);
+                    return 0;
+                }
+                pistas[lidas++] = (uint32_t)id;
+            }
+        }
+        posicao += bytesMapa;
+    } else {
+        uint64_t id = 0;
+        for (; lidas < numPistas; lidas++) {
+            uint64_t diferenca;
+            if (!lerVarint(&posicao, fim, &diferenca) || (lidas > 0 && diferenca == 0)
+                || diferenca >= numStrings - id) {
+                free(pistas);
+                return 0;
+            }
+            id += diferenca;
+            if (id == STRING_VAZIA) {
+                free(pistas);
+                return 0;
+            }
+            pistas[lidas] = (uint32_t)id;
+        }
+    }
+    if (lidas != numPistas || posicao != fim) {
+        free(pistas);
+        return 0;
+    }
+    
+    // Dados válidos: o caminho só marca as visitas e confere que as pistas salvas são
+    // exatamente as das salas visitadas (nos níveis que coletam pistas)
+    esvaziarSessao(sessao);
+    uint8_t* encontradas = (uint8_t*)calloc(numPistas + 1, 1);
+    if (encontradas == NULL) {
+        printf("Erro: Não foi possível alocar memória para restaurar a investigação.\n");
+        exit(1);
+    }
+    uint64_t distintas = 0;
+    uint32_t salaAnterior = 0;
+    int iguais = 1;
+    bit = 0;
+    sala = 0;
+    for (uint64_t i = 0; iguais; i++) {
+        uint32_t pista = mansao.salas[sala].pista;
+        sessao->visitadas[sala / 64] |= 1ull << (sala % 64);
+        if (sessao->nivel->coletaPistas && pista != STRING_VAZIA) {
+            uint32_t* salva = (uint32_t*)bsearch(&pista, pistas, numPistas, sizeof(uint32_t),
+                                                 compararIdentificadores);
+            if (salva == NULL) {
+                iguais = 0;
+            } else if (!encontradas[salva - pistas]) {
+                encontradas[salva - pistas] = 1;
+                distintas++;
+            }
+        }
+        if (i == passos) {
+            break;
+        }
+        salaAnterior = sala;
+        sala = saidasDaSala(sala)[lerSaidaDoCaminho(caminho, &bit, bitsPorSaida(grauSala(sala)))];
+    }
+    free(encontradas);
+    if (!iguais || distintas != numPistas) {
+        free(pistas);
+        esvaziarSessao(sessao);
+        return 0;
+    }
+    
+    // O inventário sai direto das pistas salvas, ordenadas pelo texto e montadas já
+    // balanceadas, e os contadores, dele: nenhuma jogada é refeita
+    qsort(pistas, numPistas, sizeof(uint32_t), compararTextosPistas);
+    sessao->raizPistas = montarArvorePistas(&sessao->arena, pistas, (int)numPistas);
+    free(pistas);
+    if (sessao->nivel->apontaSuspeitos) {
+        contarPistasPorSuspeito(sessao, sessao->raizPistas);
+    }
+    sessao->sala = sala;
+    
+    // O histórico da jogada (v) antes da retomada só é recriado se o jogador voltar além dela
+    if (passos > 0) {
+        sessao->caminhoRetomado = (uint8_t*)malloc((bitsCaminho + 7) / 8 + 1);
+        if (sessao->caminhoRetomado == NULL) {
+            printf("Erro: Não foi possível alocar memória para restaurar a investigação.\n");
+            exit(1);
+        }
+        memcpy(sessao->caminhoRetomado, caminho, (bitsCaminho + 7) / 8);
+        sessao->bitsRetomados = bitsCaminho;
+        sessao->passosRetomados = (uint32_t)passos;
+        sessao->salaAntesDaRetomada = salaAnterior;
+    }
+    return 1;
+}
+
+/*
+ * Função: refazerCaminhoRetomado
+ * Propósito: Recria o histórico da jogada (v) anterior à retomada refazendo o caminho
+ *            salvo desde a entrada, sem jogadas nem saída. Só é chamada quando o jogador
+ *            volta além da retomada, com o histórico vazio: a sessão está então no estado
+ *            retomado, que o caminho refeito reproduz
+ * Parâmetros: sessao - investigação sem passos no histórico
+ * Retorno: 1 se o histórico foi recriado, 0 se não há caminho retomado a refazer
+ */
+int refazerCaminhoRetomado(Sessao* sessao) {
+    uint8_t* caminho = sessao->caminhoRetomado;
+    uint32_t passos = sessao->passosRetomados;
+    if (caminho == NULL) {
+        return 0;
+    }
+    
+    sessao->caminhoRetomado = NULL; // Passa a ser do histórico; esvaziarSessao não o libera
+    esvaziarSessao(sessao);
+    uint64_t bit = 0;
+    for (uint32_t i = 0;; i++) {
+        uint32_t pista = mansao.salas[sessao->sala].pista;
+        if (marcarVisita(sessao) && sessao->nivel->coletaPistas && pista != STRING_VAZIA) {
+            coletarPista(sessao, pista);
+        }
+        if (i == passos) {
+            break;
+        }
+        registrarPasso(sessao, lerSaidaDoCaminho(caminho, &bit, bitsPorSaida(grauSala(sessao->sala))));
+    }
+    free(caminho);
+    return 1;
+}
+
+/*
+ * Função: salvarSessao
+ * Propósito: Grava a investigação em um arquivo com uma única escrita; o arquivo é
+ *            escrito ao lado e renomeado, então um salvamento anterior nunca fica pela metade
+ * Parâmetros: sessao - investigação em andamento
+ *            caminho - arquivo de destino
+ * Retorno: 1 em caso de sucesso, 0 em caso de erro
+ */
+int salvarSessao(Sessao* sessao, const char* caminho) {
+    size_t tamanho;
+    uint8_t* dados = codificarSessao(sessao, &tamanho);
+    
+    size_t tamanhoCaminho = strlen(caminho);
+    char* temporario = (char*)malloc(tamanhoCaminho + 5);
+    if (temporario == NULL) {
+        printf("Erro: Não foi possível alocar memória para salvar a investigação.\n");
+        exit(1);
+    }
+    memcpy(temporario, caminho, tamanhoCaminho);
+    memcpy(temporario + tamanhoCaminho, ".tmp", 5);
+    
+    int ok = 0;
+    int descritor = open(temporario, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor >= 0) {
+        ok = write(descritor, dados, tamanho) == (ssize_t)tamanho;
+        ok = close(descritor) == 0 && ok;
+        ok = ok && rename(temporario, caminho) == 0;
+        if (!ok) {
+            unlink(temporario);
+        }
+    }
+    
+    free(temporario);
+    free(dados);
+    return ok;
+}
+
+/*
+ * Função: retomarSessao
+ * Propósito: Lê uma investigação salva e a restaura na sessão
+ * Parâmetros: sessao - sessão recém-iniciada sobre o mesmo caso do salvamento
+ *            caminho - arquivo gravado por salvarSessao
+ * Retorno: void (encerra o programa se o arquivo não puder ser restaurado)
+ */
+void retomarSessao(Sessao* sessao, const char* caminho) {
+    int descritor = open(caminho, O_RDONLY);
+    struct stat info;
+    if (descritor < 0 || fstat(descritor, &info) != 0) {
+        printf("Erro: Não foi possível abrir a investigação salva '%s'.\n", caminho);
+        exit(1);
+    }
+    
+    size_t tamanho = (size_t)info.st_size;
+    uint8_t* dados = (uint8_t*)malloc(tamanho + 1);
+    if (dados == NULL) {
+        printf("Erro: Não foi possível alocar memória para restaurar a investigação.\n");
+        exit(1);
+    }
+    ssize_t lidos = read(descritor, dados, tamanho);
+    close(descritor);
+    
+    if (lidos != (ssize_t)tamanho || !decodificarSessao(sessao, dados, tamanho)) {
+        printf("Erro: A investigação salva '%s' é inválida ou pertence a outro caso.\n", caminho);
+        exit(1);
+    }
+    free(dados);
+}
@@ -0,0 +1,39 @@
+#ifndef NUCLEO_SALVAMENTO_H
+#define NUCLEO_SALVAMENTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sessao.h"
+
+#define MAGICO_SALVAMENTO "DQSV"         // Assinatura de uma investigação salva (4 bytes)
+#define VERSAO_SALVAMENTO 2              // Versão do formato de salvamento
+#define SALVAMENTO_MAPA_DE_BITS 0x01     // Pistas gravadas como mapa de bits (senão, varints)
+#define MAX_BYTES_VARINT 10              // Bytes de um varint de 64 bits no pior caso
+
+// Formato de uma investigação salva (tudo em bytes, sem ordem de bytes nem alinhamento):
+//   "DQSV", versão, flags
+//   varints: salas, strings e suspeitos do caso (recusa salvamentos de outro caso)
+//   varint: passos desde a entrada, seguido do índice da saída tomada em cada passo, com
+//   ceil(log2(saídas da sala)) bits (nenhum em corredores de uma saída só; em uma árvore
+//   binária, um bit: 1 = direita)
+//   varint: pistas coletadas, seguido de um mapa de bits com uma posição por string
+//   (SALVAMENTO_MAPA_DE_BITS) ou das diferenças entre identificadores crescentes em
+//   varints, o que for menor. Na retomada o inventário é montado das pistas salvas e o
+//   caminho só marca as visitas; o histórico da jogada (v) anterior à retomada só é
+//   refeito, seguindo o caminho, se o jogador voltar além dela.
+
+size_t escreverVarint(uint8_t* destino, uint64_t valor);
+int lerVarint(const uint8_t** posicao, const uint8_t* fim, uint64_t* valor);
+uint32_t bitsPorSaida(uint32_t grau);
+uint32_t lerSaidaDoCaminho(const uint8_t* caminho, uint64_t* bit, uint32_t largura);
+int compararIdentificadores(const void* a, const void* b);
+int compararTextosPistas(const void* a, const void* b);
+void esvaziarSessao(Sessao* sessao);
+uint8_t* codificarSessao(Sessao* sessao, size_t* tamanho);
+int decodificarSessao(Sessao* sessao, const uint8_t* dados, size_t tamanho);
+int refazerCaminhoRetomado(Sessao* sessao);
+int salvarSessao(Sessao* sessao, const char* caminho);
+void retomarSessao(Sessao* sessao, const char* caminho);
+
+#endif
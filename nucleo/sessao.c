@@ -0,0 +1,738 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "sessao.h"
+#include "suspeitos.h"
+#include "dicas.h"
+#include "salvamento.h"
+#include "busca.h"
+#include "instrumentacao.h"
+
+/*
+ * Função: mostrar
+ * Propósito: Escreve a saída do jogo (descartada sem formatação em sessões silenciosas)
+ * Parâmetros: sessao - investigação que produz a saída
+ *            formato - formato no estilo de printf, seguido dos valores
+ * Retorno: void
+ */
+void mostrar(Sessao* sessao, const char* formato, ...) {
+    if (sessao->saida == NULL) {
+        return;
+    }
+    
+    va_list valores;
+    va_start(valores, formato);
+    vfprintf(sessao->saida, formato, valores);
+    va_end(valores);
+}
+
+/*
+ * Função: carregarRoteiro
+ * Propósito: Lê todo o roteiro de jogadas para a memória (modo lote)
+ * Parâmetros: caminho - arquivo do roteiro ("-" para a entrada padrão)
+ * Retorno: roteiro carregado (terminado em '\0'; liberado por quem chamou)
+ */
+char* carregarRoteiro(const char* caminho) {
+    FILE* arquivo = strcmp(caminho, "-") == 0 ? stdin : fopen(caminho, "r");
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível abrir o roteiro de jogadas '%s'.\n", caminho);
+        exit(1);
+    }
+    
+    size_t capacidade = CAPACIDADE_ROTEIRO_INICIAL;
+    size_t tamanho = 0;
+    char* roteiro = (char*)malloc(capacidade);
+    while (roteiro != NULL) {
+        tamanho += fread(roteiro + tamanho, 1, capacidade - tamanho - 1, arquivo);
+        if (tamanho < capacidade - 1) {
+            break; // Fim do arquivo (ou erro de leitura)
+        }
+        capacidade *= 2;
+        char* novoRoteiro = (char*)realloc(roteiro, capacidade);
+        if (novoRoteiro == NULL) {
+            free(roteiro);
+        }
+        roteiro = novoRoteiro;
+    }
+    if (roteiro == NULL) {
+        printf("Erro: Não foi possível alocar memória para o roteiro de jogadas.\n");
+        exit(1);
+    }
+    roteiro[tamanho] = '\0';
+    
+    if (arquivo != stdin) {
+        fclose(arquivo);
+    }
+    return roteiro;
+}
+
+/*
+ * Função: avancarRoteiro
+ * Propósito: Pula espaços e comentários ("#" até o fim da linha) do roteiro
+ * Parâmetros: sessao - investigação dirigida por roteiro
+ * Retorno: 1 se ainda há jogadas, 0 no fim do roteiro
+ */
+int avancarRoteiro(Sessao* sessao) {
+    const char* texto = sessao->roteiro;
+    for (;;) {
+        char c = texto[sessao->posicaoRoteiro];
+        if (c == '#') {
+            while (texto[sessao->posicaoRoteiro] != '\0' && texto[sessao->posicaoRoteiro] != '\n') {
+                sessao->posicaoRoteiro++;
+            }
+        } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            sessao->posicaoRoteiro++;
+        } else {
+            return c != '\0';
+        }
+    }
+}
+
+/*
+ * Função: lerOpcao
+ * Propósito: Obtém a próxima jogada: do teclado (com prompt) ou do roteiro (modo lote)
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: caractere da jogada ('s' no fim da entrada, encerrando a exploração)
+ */
+char lerOpcao(Sessao* sessao) {
+    if (sessao->roteiro != NULL) {
+        return avancarRoteiro(sessao) ? sessao->roteiro[sessao->posicaoRoteiro++] : 's';
+    }
+    
+    char opcao;
+    mostrar(sessao, "\nEscolha uma opção: ");
+    if (scanf(" %c", &opcao) != 1) {
+        return 's';
+    }
+    return opcao;
+}
+
+/*
+ * Função: lerNumero
+ * Propósito: Obtém um número do teclado ou do roteiro (modo lote)
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: número lido (0 se a entrada terminou ou não é um número)
+ */
+int lerNumero(Sessao* sessao) {
+    if (sessao->roteiro != NULL) {
+        if (!avancarRoteiro(sessao)) {
+            return 0;
+        }
+        const char* inicio = sessao->roteiro + sessao->posicaoRoteiro;
+        char* fim;
+        long numero = strtol(inicio, &fim, 10);
+        if (fim == inicio) {
+            sessao->posicaoRoteiro++; // Descarta o caractere inválido
+            return 0;
+        }
+        sessao->posicaoRoteiro += fim - inicio;
+        return numero > INT32_MAX || numero < INT32_MIN ? 0 : (int)numero;
+    }
+    
+    int numero;
+    if (scanf("%d", &numero) != 1) {
+        return 0;
+    }
+    return numero;
+}
+
+/*
+ * Função: lerRestoDoNumero
+ * Propósito: Completa um número cujo primeiro dígito já foi lido como opção (passagens)
+ * Parâmetros: sessao - investigação em andamento
+ *            primeiroDigito - dígito devolvido por lerOpcao
+ * Retorno: número lido (UINT32_MAX se não couber em 32 bits)
+ */
+uint32_t lerRestoDoNumero(Sessao* sessao, char primeiroDigito) {
+    uint64_t numero = (uint64_t)(primeiroDigito - '0');
+    for (;;) {
+        int c;
+        if (sessao->roteiro != NULL) {
+            c = sessao->roteiro[sessao->posicaoRoteiro];
+            if (c >= '0' && c <= '9') {
+                sessao->posicaoRoteiro++;
+            }
+        } else {
+            c = getchar();
+            if (c != EOF && (c < '0' || c > '9')) {
+                ungetc(c, stdin);
+            }
+        }
+        if (c < '0' || c > '9') {
+            break;
+        }
+        if (numero < UINT32_MAX) {
+            numero = numero * 10 + (uint64_t)(c - '0');
+        }
+    }
+    return numero < UINT32_MAX ? (uint32_t)numero : UINT32_MAX;
+}
+
+/*
+ * Função: marcarUmaPista
+ * Propósito: Põe ou tira um suspeito da lista dos que têm exatamente uma pista coletada,
+ *            em O(1) (a remoção traz o último da lista para o lugar dele)
+ * Parâmetros: sessao - investigação em andamento
+ *            idSuspeito - identificador do suspeito no registro
+ *            temUmaPista - 1 para pôr o suspeito na lista, 0 para tirá-lo
+ * Retorno: void
+ */
+void marcarUmaPista(Sessao* sessao, int idSuspeito, int temUmaPista) {
+    if (temUmaPista) {
+        sessao->posicaoComUmaPista[idSuspeito] = sessao->numComUmaPista;
+        sessao->comUmaPista[sessao->numComUmaPista++] = idSuspeito;
+        return;
+    }
+    
+    int posicao = sessao->posicaoComUmaPista[idSuspeito];
+    int ultimo = sessao->comUmaPista[--sessao->numComUmaPista];
+    sessao->comUmaPista[posicao] = ultimo;
+    sessao->posicaoComUmaPista[ultimo] = posicao;
+    sessao->posicaoComUmaPista[idSuspeito] = -1;
+}
+
+/*
+ * Função: adicionarSuspeitoContador
+ * Propósito: Incrementa o contador de pistas de um suspeito e mantém a lista dos
+ *            suspeitos com exatamente uma pista
+ * Parâmetros: sessao - investigação em andamento
+ *            idSuspeito - identificador do suspeito no registro
+ *            pista - pista coletada contra o suspeito
+ * Retorno: void
+ */
+void adicionarSuspeitoContador(Sessao* sessao, int idSuspeito, uint32_t pista) {
+    INSTRUMENTAR(uint64_t inicio = relogioInstrumentacao();)
+    int contagem = ++sessao->contagemSuspeitos[idSuspeito];
+    if (contagem == 1) {
+        sessao->primeiraPista[idSuspeito] = pista;
+        marcarUmaPista(sessao, idSuspeito, 1);
+    } else if (contagem == 2) {
+        marcarUmaPista(sessao, idSuspeito, 0);
+    }
+    INSTRUMENTAR(somarMetrica(METRICA_ATUALIZACOES, 1);
+                 medirDesde(METRICA_NS_ATUALIZACOES, inicio);)
+}
+
+/*
+ * Função: removerSuspeitoContador
+ * Propósito: Decrementa o contador de pistas de um suspeito ao desfazer o passo que o
+ *            pontuou; como os passos se desfazem em ordem inversa, a pista que sobra de
+ *            um suspeito que volta a ter uma só é a primeira coletada contra ele
+ * Parâmetros: sessao - investigação em andamento
+ *            idSuspeito - identificador do suspeito no registro
+ * Retorno: void
+ */
+void removerSuspeitoContador(Sessao* sessao, int idSuspeito) {
+    int contagem = --sessao->contagemSuspeitos[idSuspeito];
+    if (contagem == 1) {
+        marcarUmaPista(sessao, idSuspeito, 1);
+    } else if (contagem == 0) {
+        marcarUmaPista(sessao, idSuspeito, 0);
+    }
+}
+
+/*
+ * Função: zerarContadores
+ * Propósito: Zera o contador de pistas de todos os suspeitos registrados
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: void
+ */
+void zerarContadores(Sessao* sessao) {
+    memset(sessao->contagemSuspeitos, 0, suspeitos.quantidade * sizeof(int));
+    memset(sessao->posicaoComUmaPista, 0xff, suspeitos.quantidade * sizeof(int));
+    sessao->numComUmaPista = 0;
+}
+
+// Par (contador, suspeito) ordenado pelo ranking; leva o contador junto para o qsort
+// não depender de estado global
+typedef struct EntradaRanking {
+    int contador;
+    int id;
+} EntradaRanking;
+
+/*
+ * Função: compararRanking
+ * Propósito: Ordena suspeitos por contador decrescente (empate: ordem de registro)
+ * Parâmetros: a, b - ponteiros para entradas do ranking
+ * Retorno: negativo, zero ou positivo, no padrão do qsort
+ */
+int compararRanking(const void* a, const void* b) {
+    const EntradaRanking* entradaA = (const EntradaRanking*)a;
+    const EntradaRanking* entradaB = (const EntradaRanking*)b;
+    int diferenca = entradaB->contador - entradaA->contador;
+    return diferenca != 0 ? diferenca : entradaA->id - entradaB->id;
+}
+
+/*
+ * Função: listarSuspeitosRanqueados
+ * Propósito: Monta o ranking dos suspeitos com pelo menos uma pista
+ * Parâmetros: sessao - investigação em andamento
+ *            ranking - vetor de saída com os identificadores (capacidade >= limite)
+ *            limite - número máximo de suspeitos desejados (top-k)
+ * Retorno: quantidade de identificadores escritos em "ranking"
+ */
+int listarSuspeitosRanqueados(Sessao* sessao, int* ranking, int limite) {
+    EntradaRanking* candidatos = (EntradaRanking*)malloc((suspeitos.quantidade + 1) * sizeof(EntradaRanking));
+    
+    if (candidatos == NULL) {
+        printf("Erro: Não foi possível alocar memória para o ranking.\n");
+        exit(1);
+    }
+    
+    int total = 0;
+    for (int id = 0; id < suspeitos.quantidade; id++) {
+        if (sessao->contagemSuspeitos[id] > 0) {
+            candidatos[total].contador = sessao->contagemSuspeitos[id];
+            candidatos[total].id = id;
+            total++;
+        }
+    }
+    
+    qsort(candidatos, total, sizeof(EntradaRanking), compararRanking);
+    
+    if (total > limite) {
+        total = limite;
+    }
+    for (int i = 0; i < total; i++) {
+        ranking[i] = candidatos[i].id;
+    }
+    free(candidatos);
+    
+    return total;
+}
+
+/*
+ * Função: contarPistasPorSuspeito
+ * Propósito: Recalcula do zero quantas pistas apontam para cada suspeito
+ *            (o jogo mantém os contadores durante a exploração; esta função
+ *            serve para reconstruí-los a partir de um inventário completo)
+ * Parâmetros: sessao - investigação cujos contadores são reconstruídos
+ *            raiz - raiz da árvore AVL de pistas
+ * Retorno: void
+ */
+void contarPistasPorSuspeito(Sessao* sessao, PistaNode* raiz) {
+    if (raiz == NULL) {
+        return;
+    }
+    
+    uint32_t* pistas = (uint32_t*)malloc((size_t)raiz->tamanho * sizeof(uint32_t));
+    int* idsSuspeitos = (int*)malloc((size_t)raiz->tamanho * sizeof(int));
+    if (pistas == NULL || idsSuspeitos == NULL) {
+        printf("Erro: Não foi possível alocar memória para o inventário de pistas.\n");
+        exit(1);
+    }
+    
+    buscarSuspeitosDaArvore(raiz, pistas, idsSuspeitos);
+    for (int i = 0; i < raiz->tamanho; i++) {
+        if (idsSuspeitos[i] >= 0) {
+            adicionarSuspeitoContador(sessao, idsSuspeitos[i], pistas[i]);
+        }
+    }
+    
+    free(pistas);
+    free(idsSuspeitos);
+}
+
+/*
+ * Função: exibirPistas
+ * Propósito: Exibe todas as pistas da árvore AVL em ordem alfabética
+ * Parâmetros: sessao - investigação que produz a saída
+ *            raiz - ponteiro para a raiz da árvore AVL
+ *            comSuspeitos - 1 para mostrar o suspeito apontado por cada pista
+ * Retorno: void
+ */
+void exibirPistas(Sessao* sessao, PistaNode* raiz, int comSuspeitos) {
+    if (raiz == NULL || sessao->saida == NULL) {
+        return;
+    }
+    
+    uint32_t* pistas = (uint32_t*)malloc((size_t)raiz->tamanho * sizeof(uint32_t));
+    int* idsSuspeitos = (int*)malloc((size_t)raiz->tamanho * sizeof(int));
+    if (pistas == NULL || idsSuspeitos == NULL) {
+        printf("Erro: Não foi possível alocar memória para o inventário de pistas.\n");
+        exit(1);
+    }
+    
+    if (comSuspeitos) {
+        buscarSuspeitosDaArvore(raiz, pistas, idsSuspeitos);
+    } else {
+        listarPistasEmOrdem(raiz, pistas);
+    }
+    for (int i = 0; i < raiz->tamanho; i++) {
+        mostrar(sessao, "  • %s", textoDaString(pistas[i]));
+        if (comSuspeitos && idsSuspeitos[i] >= 0) {
+            mostrar(sessao, " → %s", textoDaString(suspeitos.nomes[idsSuspeitos[i]]));
+        }
+        mostrar(sessao, "\n");
+    }
+    
+    free(pistas);
+    free(idsSuspeitos);
+}
+
+/*
+ * Função: registrarPasso
+ * Propósito: Move o jogador por uma das saídas da sala atual e guarda o passo no histórico
+ * Parâmetros: sessao - investigação em andamento
+ *            saida - índice da saída entre as saídas da sala atual (menor que grauSala)
+ * Retorno: void
+ */
+void registrarPasso(Sessao* sessao, uint32_t saida) {
+    if (sessao->numHistorico == sessao->capacidadeHistorico) {
+        uint32_t novaCapacidade = sessao->capacidadeHistorico == 0 ? CAPACIDADE_HISTORICO_INICIAL
+                                                                   : sessao->capacidadeHistorico * 2;
+        PassoAnterior* novoHistorico = (PassoAnterior*)realloc(sessao->historico,
+                                                               novaCapacidade * sizeof(PassoAnterior));
+        if (novoHistorico == NULL) {
+            printf("Erro: Não foi possível alocar memória para o histórico de passos.\n");
+            exit(1);
+        }
+        sessao->historico = novoHistorico;
+        sessao->capacidadeHistorico = novaCapacidade;
+    }
+    PassoAnterior* anterior = &sessao->historico[sessao->numHistorico++];
+    anterior->sala = sessao->sala;
+    anterior->saida = saida;
+    anterior->suspeitoPontuado = -1;
+    anterior->primeiraVisita = 0;
+    anterior->pistaNova = STRING_VAZIA;
+    anterior->raizPistas = sessao->raizPistas;
+    sessao->sala = saidasDaSala(sessao->sala)[saida];
+}
+
+/*
+ * Função: marcarVisita
+ * Propósito: Marca a sala atual como visitada no mapa de bits da sessão; a primeira visita
+ *            fica registrada no último passo para que a jogada (v) possa desmarcá-la
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: 1 se é a primeira visita à sala, 0 se o jogador já passou por ela
+ */
+int marcarVisita(Sessao* sessao) {
+    uint64_t* palavra = &sessao->visitadas[sessao->sala / 64];
+    uint64_t bit = 1ull << (sessao->sala % 64);
+    if (*palavra & bit) {
+        return 0;
+    }
+    
+    *palavra |= bit;
+    if (sessao->numHistorico > 0) {
+        sessao->historico[sessao->numHistorico - 1].primeiraVisita = 1;
+    }
+    return 1;
+}
+
+/*
+ * Função: voltarPasso
+ * Propósito: Desfaz o último passo em O(1): restaura a versão anterior do inventário, o
+ *            contador do suspeito pontuado e a marca de visita da sala abandonada (e
+ *            retira do índice de busca a pista que o passo acrescentou)
+ * Parâmetros: sessao - investigação com pelo menos um passo no histórico
+ * Retorno: identificador da sala anterior
+ */
+uint32_t voltarPasso(Sessao* sessao) {
+    PassoAnterior* anterior = &sessao->historico[--sessao->numHistorico];
+    if (anterior->suspeitoPontuado >= 0) {
+        removerSuspeitoContador(sessao, anterior->suspeitoPontuado);
+    }
+    if (anterior->primeiraVisita) {
+        sessao->visitadas[sessao->sala / 64] &= ~(1ull << (sessao->sala % 64));
+    }
+    if (anterior->pistaNova != STRING_VAZIA && sessao->busca != NULL) {
+        marcarPistaBusca(sessao->busca, anterior->pistaNova, 0);
+    }
+    sessao->raizPistas = anterior->raizPistas;
+    sessao->sala = anterior->sala;
+    return anterior->sala;
+}
+
+/*
+ * Função: coletarPista
+ * Propósito: Guarda a pista da sala em uma nova versão do inventário (a anterior fica no
+ *            histórico) e, nos níveis que apontam suspeitos, pontua o suspeito se a pista
+ *            é inédita (mesma deduplicação da árvore); a pista inédita também entra no
+ *            índice de busca da sessão, se já existir
+ * Parâmetros: sessao - investigação em andamento
+ *            pista - identificador da pista encontrada
+ * Retorno: associação da pista com seu suspeito (NULL se não houver ou o nível não aponta)
+ */
+HashNode* coletarPista(Sessao* sessao, uint32_t pista) {
+    int pistasAntes = contarPistas(sessao->raizPistas);
+    sessao->raizPistas = inserirPistaPersistente(&sessao->arena, sessao->raizPistas, pista);
+    int pistaNova = contarPistas(sessao->raizPistas) > pistasAntes;
+    if (pistaNova) {
+        if (sessao->numHistorico > 0) {
+            sessao->historico[sessao->numHistorico - 1].pistaNova = pista;
+        }
+        if (sessao->busca != NULL) {
+            marcarPistaBusca(sessao->busca, pista, 1);
+        }
+    }
+    
+    HashNode* associacao = sessao->nivel->apontaSuspeitos ? buscarNaHash(pista) : NULL;
+    if (associacao != NULL && pistaNova) {
+        adicionarSuspeitoContador(sessao, associacao->idSuspeito, pista);
+        if (sessao->numHistorico > 0) {
+            sessao->historico[sessao->numHistorico - 1].suspeitoPontuado = associacao->idSuspeito;
+        }
+    }
+    return associacao;
+}
+
+/*
+ * Função: explorarSalas
+ * Propósito: Permite a navegação interativa a partir da sala atual da sessão; conforme
+ *            o nível, com coleta automática de pistas, suspeitos e dicas
+ * Parâmetros: sessao - investigação em andamento
+ * Retorno: void
+ */
+void explorarSalas(Sessao* sessao) {
+    const Nivel* nivel = sessao->nivel;
+    char opcao;
+    
+    for (;;) {
+        INSTRUMENTAR(uint64_t inicioVisita = relogioInstrumentacao();)
+        uint32_t idSala = sessao->sala;
+        const Sala* salaAtual = &mansao.salas[idSala];
+        const uint32_t* saidas = saidasDaSala(idSala);
+        uint32_t grau = grauSala(idSala);
+        // Esquerda e direita (se houver) são as primeiras saídas; as demais são passagens
+        uint32_t saidaDireita = salaAtual->esquerda != SEM_SALA;
+        uint32_t saidasDaArvore = saidaDireita + (salaAtual->direita != SEM_SALA);
+        mostrar(sessao, "\n=== Você está na: %s ===\n", textoDaString(mansao.nomes[idSala]));
+        
+        // Verifica se há uma pista na sala atual (nos níveis que coletam pistas); em uma
+        // sala já visitada a pista já está no inventário
+        int primeiraVisita = marcarVisita(sessao);
+        if (nivel->coletaPistas) {
+            if (!primeiraVisita) {
+                mostrar(sessao, "   Você já examinou esta sala.\n");
+            } else if (salaAtual->pista != STRING_VAZIA) {
+                mostrar(sessao, "🔍 PISTA ENCONTRADA: %s\n", textoDaString(salaAtual->pista));
+                HashNode* associacao = coletarPista(sessao, salaAtual->pista);
+                if (associacao != NULL) {
+                    mostrar(sessao, "   Esta pista aponta para: %s\n",
+                           textoDaString(suspeitos.nomes[associacao->idSuspeito]));
+                }
+                mostrar(sessao, "   (Pista adicionada ao seu inventário)\n");
+            } else {
+                mostrar(sessao, "   Nenhuma pista encontrada nesta sala.\n");
+            }
+        }
+        
+        // Verifica se é uma sala sem saídas
+        if (nivel->paraSemSaida && grau == 0) {
+            mostrar(sessao, "Esta sala não possui mais caminhos!\n");
+            mostrar(sessao, "Fim da exploração. Obrigado por jogar!\n");
+            INSTRUMENTAR(somarMetrica(METRICA_VISITAS, 1);
+                         medirDesde(METRICA_NS_VISITAS, inicioVisita);)
+            return;
+        }
+        
+        // Exibe opções disponíveis
+        mostrar(sessao, "\nOpções disponíveis:\n");
+        if (salaAtual->esquerda != SEM_SALA) {
+            mostrar(sessao, "(e) - Ir para a esquerda: %s\n", textoDaString(mansao.nomes[salaAtual->esquerda]));
+        }
+        if (salaAtual->direita != SEM_SALA) {
+            mostrar(sessao, "(d) - Ir para a direita: %s\n", textoDaString(mansao.nomes[salaAtual->direita]));
+        }
+        for (uint32_t i = saidasDaArvore; i < grau; i++) {
+            mostrar(sessao, "(%u) - Passagem para: %s\n", i - saidasDaArvore + 1,
+                    textoDaString(mansao.nomes[saidas[i]]));
+        }
+        if (sessao->numHistorico > 0 || sessao->caminhoRetomado != NULL) {
+            uint32_t salaAnterior = sessao->numHistorico > 0 ? sessao->historico[sessao->numHistorico - 1].sala
+                                                             : sessao->salaAntesDaRetomada;
+            mostrar(sessao, "(v) - Voltar para: %s\n", textoDaString(mansao.nomes[salaAnterior]));
+        }
+        if (nivel->temDicas) {
+            mostrar(sessao, "(h) - Pedir uma dica sobre os caminhos\n");
+        }
+        if (nivel->temBusca) {
+            mostrar(sessao, "(b) - Buscar nas pistas coletadas\n");
+        }
+        if (sessao->arquivoSalvamento != NULL) {
+            mostrar(sessao, "(g) - Salvar a investigação\n");
+        }
+        mostrar(sessao, "(s) - %s\n", nivel->opcaoSair);
+        INSTRUMENTAR(somarMetrica(METRICA_VISITAS, 1);
+                     medirDesde(METRICA_NS_VISITAS, inicioVisita);)
+        
+        opcao = lerOpcao(sessao);
+        
+        switch (opcao) {
+            case 'e':
+            case 'E':
+                if (salaAtual->esquerda != SEM_SALA) {
+                    registrarPasso(sessao, 0);
+                    mostrar(sessao, "Você foi para a esquerda...\n");
+                } else {
+                    mostrar(sessao, "Não há caminho à esquerda!\n");
+                }
+                break;
+                
+            case 'd':
+            case 'D':
+                if (salaAtual->direita != SEM_SALA) {
+                    registrarPasso(sessao, saidaDireita);
+                    mostrar(sessao, "Você foi para a direita...\n");
+                } else {
+                    mostrar(sessao, "Não há caminho à direita!\n");
+                }
+                break;
+                
+            case '1': case '2': case '3': case '4': case '5':
+            case '6': case '7': case '8': case '9': {
+                // Passagens numeradas a partir de 1 (podem ter mais de um dígito)
+                uint32_t passagem = lerRestoDoNumero(sessao, opcao);
+                if (passagem <= grau - saidasDaArvore) {
+                    registrarPasso(sessao, saidasDaArvore + passagem - 1);
+                    mostrar(sessao, "Você atravessou a passagem...\n");
+                } else if (grau > saidasDaArvore) {
+                    mostrar(sessao, "Não há passagem %u nesta sala!\n", passagem);
+                } else {
+                    mostrar(sessao, "%s\n", nivel->opcaoInvalida);
+                }
+                break;
+            }
+                
+            case 'v':
+            case 'V':
+                if (sessao->numHistorico > 0 || refazerCaminhoRetomado(sessao)) {
+                    voltarPasso(sessao);
+                    mostrar(sessao, "Você voltou para a sala anterior...\n");
+                } else {
+                    mostrar(sessao, "Não há sala anterior para voltar!\n");
+                }
+                break;
+                
+            case 'h':
+            case 'H':
+                if (nivel->temDicas) {
+                    mostrarDica(sessao, idSala);
+                } else {
+                    mostrar(sessao, "%s\n", nivel->opcaoInvalida);
+                }
+                break;
+                
+            case 'b':
+            case 'B':
+                if (nivel->temBusca) {
+                    mostrarBusca(sessao);
+                } else {
+                    mostrar(sessao, "%s\n", nivel->opcaoInvalida);
+                }
+                break;
+                
+            case 'g':
+            case 'G':
+                if (sessao->arquivoSalvamento == NULL) {
+                    mostrar(sessao, "%s\n", nivel->opcaoInvalida);
+                } else if (salvarSessao(sessao, sessao->arquivoSalvamento)) {
+                    mostrar(sessao, "Investigação salva em '%s'.\n", sessao->arquivoSalvamento);
+                } else {
+                    mostrar(sessao, "Não foi possível salvar a investigação em '%s'.\n",
+                            sessao->arquivoSalvamento);
+                }
+                break;
+                
+            case 's':
+            case 'S':
+                nivel->sair(sessao);
+                return;
+                
+            default:
+                mostrar(sessao, "%s\n", nivel->opcaoInvalida);
+                break;
+        }
+    }
+}
+
+/*
+ * Função: iniciarSessao
+ * Propósito: Prepara uma investigação nova sobre o caso já carregado
+ * Parâmetros: sessao - sessão a ser inicializada
+ *            nivel - nível jogado (NIVEL_NOVATO, NIVEL_AVENTUREIRO ou NIVEL_MESTRE)
+ *            saida - destino da saída do jogo (NULL = silenciosa)
+ *            roteiro - jogadas do modo lote (NULL = teclado)
+ * Retorno: void
+ */
+void iniciarSessao(Sessao* sessao, const Nivel* nivel, FILE* saida, const char* roteiro) {
+    sessao->nivel = nivel;
+    sessao->arena.atual = NULL;
+    sessao->raizPistas = NULL;
+    sessao->contagemSuspeitos = (int*)calloc(suspeitos.quantidade + 1, sizeof(int));
+    sessao->primeiraPista = (uint32_t*)malloc((suspeitos.quantidade + 1) * sizeof(uint32_t));
+    sessao->comUmaPista = (int*)malloc((suspeitos.quantidade + 1) * sizeof(int));
+    sessao->posicaoComUmaPista = (int*)malloc((suspeitos.quantidade + 1) * sizeof(int));
+    INSTRUMENTAR(somarMetrica(METRICA_SESSOES, 1);)
+    sessao->saida = saida;
+    sessao->roteiro = roteiro;
+    sessao->posicaoRoteiro = 0;
+    sessao->sala = 0;
+    sessao->visitadas = (uint64_t*)calloc(((size_t)mansao.quantidade + 63) / 64, sizeof(uint64_t));
+    sessao->arquivoSalvamento = NULL;
+    sessao->historico = NULL;
+    sessao->numHistorico = 0;
+    sessao->capacidadeHistorico = 0;
+    sessao->caminhoRetomado = NULL;
+    sessao->bitsRetomados = 0;
+    sessao->passosRetomados = 0;
+    sessao->salaAntesDaRetomada = 0;
+    sessao->acusado = -1;
+    sessao->pistasDoAcusado = 0;
+    sessao->busca = NULL;
+    
+    if (sessao->contagemSuspeitos == NULL || sessao->primeiraPista == NULL || sessao->comUmaPista == NULL
+        || sessao->posicaoComUmaPista == NULL || sessao->visitadas == NULL) {
+        printf("Erro: Não foi possível alocar memória para a sessão.\n");
+        exit(1);
+    }
+    zerarContadores(sessao);
+}
+
+/*
+ * Função: encerrarSessao
+ * Propósito: Libera o estado da investigação (as pistas saem junto com a arena)
+ * Parâmetros: sessao - sessão a ser encerrada
+ * Retorno: void
+ */
+void encerrarSessao(Sessao* sessao) {
+    liberarArena(&sessao->arena);
+    sessao->raizPistas = NULL;
+    free(sessao->contagemSuspeitos);
+    sessao->contagemSuspeitos = NULL;
+    free(sessao->primeiraPista);
+    sessao->primeiraPista = NULL;
+    free(sessao->comUmaPista);
+    sessao->comUmaPista = NULL;
+    free(sessao->posicaoComUmaPista);
+    sessao->posicaoComUmaPista = NULL;
+    free(sessao->visitadas);
+    sessao->visitadas = NULL;
+    free(sessao->historico);
+    sessao->historico = NULL;
+    free(sessao->caminhoRetomado);
+    sessao->caminhoRetomado = NULL;
+    liberarBuscaSessao(sessao);
+}
+
+/*
+ * Função: jogarSessao
+ * Propósito: Conduz uma partida completa: apresentação, exploração e encerramento do nível
+ * Parâmetros: sessao - investigação inicializada
+ * Retorno: void
+ */
+void jogarSessao(Sessao* sessao) {
+    // Apresentação do jogo
+    sessao->nivel->apresentar(sessao);
+    
+    // Inicia a exploração pela entrada da mansão (ou pela sala de uma investigação retomada)
+    explorarSalas(sessao);
+    
+    if (sessao->nivel->despedida != NULL) {
+        mostrar(sessao, "%s", sessao->nivel->despedida);
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef NUCLEO_SESSAO_H
+#define NUCLEO_SESSAO_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memoria.h"
+#include "pistas.h"
+#include "mansao.h"
+#include "suspeitos.h"
+
+#define CAPACIDADE_ROTEIRO_INICIAL 4096 // Capacidade inicial do roteiro de jogadas
+#define CAPACIDADE_HISTORICO_INICIAL 64  // Capacidade inicial do histórico de passos
+
+typedef struct Nivel Nivel;
+typedef struct BuscaSessao BuscaSessao;
+
+// Estado anterior a um passo, guardado para a jogada (v); como a árvore de pistas é
+// persistente, voltar é só restaurar a raiz da versão anterior. O histórico (sala e
+// saída de cada passo), depois do caminho retomado, é o caminho gravado pelo salvamento
+typedef struct PassoAnterior {
+    uint32_t sala;                // Sala de onde o jogador saiu
+    uint32_t saida;               // Índice da saída tomada entre as saídas dessa sala
+    int suspeitoPontuado;         // Suspeito pontuado pela pista da sala de destino (-1 se nenhum)
+    int primeiraVisita;           // 1 se o passo levou a uma sala ainda não visitada
+    uint32_t pistaNova;           // Pista que o passo acrescentou ao inventário (STRING_VAZIA se nenhuma)
+    PistaNode* raizPistas;        // Versão do inventário antes do passo
+} PassoAnterior;
+
+// Estado de uma investigação; o caso carregado (mansão, strings, pistas e suspeitos)
+// é somente leitura durante o jogo e pode ser compartilhado por várias sessões
+typedef struct Sessao {
+    const Nivel* nivel;           // Regras e textos do nível jogado
+    Arena arena;                  // Dona dos nós de pistas desta sessão
+    PistaNode* raizPistas;        // Inventário de pistas coletadas (árvore AVL)
+    int* contagemSuspeitos;       // Pistas coletadas contra cada suspeito
+    uint32_t* primeiraPista;      // Primeira pista coletada contra cada suspeito (a única, se tem uma)
+    int* comUmaPista;             // Suspeitos com exatamente uma pista coletada (sem ordem)
+    int* posicaoComUmaPista;      // Índice de cada suspeito em "comUmaPista" (-1 se não está lá)
+    int numComUmaPista;           // Suspeitos em "comUmaPista"
+    FILE* saida;                  // Destino da saída do jogo (NULL = silenciosa)
+    const char* roteiro;          // Jogadas do modo lote (NULL = teclado)
+    size_t posicaoRoteiro;        // Próxima posição a ser lida do roteiro
+    uint32_t sala;                // Sala onde o jogador está
+    uint64_t* visitadas;          // Mapa de bits das salas já visitadas (a mansão pode ter ciclos)
+    const char* arquivoSalvamento; // Destino da jogada (g) (NULL = sem salvamento)
+    PassoAnterior* historico;     // Passos desde a entrada, que podem ser desfeitos
+    uint32_t numHistorico;        // Número de passos em "historico"
+    uint32_t capacidadeHistorico; // Capacidade alocada de "historico"
+    uint8_t* caminhoRetomado;     // Saídas do caminho salvo antes do histórico, cujos passos só
+                                  //   são recriados se o jogador voltar além da retomada (NULL se nenhum)
+    uint64_t bitsRetomados;       // Bits de "caminhoRetomado"
+    uint32_t passosRetomados;     // Passos de "caminhoRetomado"
+    uint32_t salaAntesDaRetomada; // Sala de onde partiu o último passo de "caminhoRetomado"
+    int acusado;                  // Suspeito acusado no julgamento (-1 se nenhum)
+    int pistasDoAcusado;          // Pistas contra o acusado no momento do veredito
+    BuscaSessao* busca;           // Índice das pistas coletadas para a jogada (b) (NULL antes da primeira)
+} Sessao;
+
+// Regras e textos de um nível: os três níveis usam o mesmo laço de exploração
+struct Nivel {
+    int coletaPistas;             // Mostra a pista de cada sala e a guarda no inventário
+    int apontaSuspeitos;          // Mostra o suspeito de cada pista e conta as pistas contra ele
+    int temDicas;                 // Oferece a opção (h)
+    int temBusca;                 // Oferece a opção (b)
+    int paraSemSaida;             // Encerra a exploração ao chegar a uma sala sem saída
+    const char* opcaoSair;        // Descrição da opção (s)
+    const char* opcaoInvalida;    // Aviso para jogadas desconhecidas
+    const char* despedida;        // Mostrada depois da exploração (NULL se nenhuma)
+    void (*apresentar)(Sessao* sessao);  // Abertura do jogo
+    void (*sair)(Sessao* sessao);        // Jogada (s): relatório ou julgamento final
+};
+
+void mostrar(Sessao* sessao, const char* formato, ...);
+char* carregarRoteiro(const char* caminho);
+int avancarRoteiro(Sessao* sessao);
+char lerOpcao(Sessao* sessao);
+int lerNumero(Sessao* sessao);
+uint32_t lerRestoDoNumero(Sessao* sessao, char primeiroDigito);
+void marcarUmaPista(Sessao* sessao, int idSuspeito, int temUmaPista);
+void adicionarSuspeitoContador(Sessao* sessao, int idSuspeito, uint32_t pista);
+void removerSuspeitoContador(Sessao* sessao, int idSuspeito);
+void zerarContadores(Sessao* sessao);
+int listarSuspeitosRanqueados(Sessao* sessao, int* ranking, int limite);
+void contarPistasPorSuspeito(Sessao* sessao, PistaNode* raiz);
+void exibirPistas(Sessao* sessao, PistaNode* raiz, int comSuspeitos);
+void registrarPasso(Sessao* sessao, uint32_t saida);
+int marcarVisita(Sessao* sessao);
+uint32_t voltarPasso(Sessao* sessao);
+HashNode* coletarPista(Sessao* sessao, uint32_t pista);
+void explorarSalas(Sessao* sessao);
+void iniciarSessao(Sessao* sessao, const Nivel* nivel, FILE* saida, const char* roteiro);
+void encerrarSessao(Sessao* sessao);
+void jogarSessao(Sessao* sessao);
+
+#endif
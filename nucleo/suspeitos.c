@@ -0,0 +1,369 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "suspeitos.h"
+#include "memoria.h"
+#include "instrumentacao.h"
+
+#if defined(__AVX2__)
+#define SONDAGEM_SIMD 4                  // Entradas da tabela hash comparadas por instrução
+#define MASCARA_PISTAS_SIMD 0x55         // Colunas de 32 bits que guardam pistas
+#elif defined(__SSE2__)
+#define SONDAGEM_SIMD 2
+#define MASCARA_PISTAS_SIMD 0x5
+#else
+#define SONDAGEM_SIMD 1                  // Sem SIMD: sondagem escalar
+#endif
+
+// Associações pista -> suspeito e registro de suspeitos do caso carregado
+TabelaHash tabelaHash = {NULL, 0, 0};
+RegistroSuspeitos suspeitos = {NULL, 0, 0, NULL, 0};
+
+/*
+ * Função: redimensionarIndiceSuspeitos
+ * Propósito: Reconstrói o índice de nomes do registro de suspeitos com nova capacidade
+ * Parâmetros: novaCapacidade - nova quantidade de posições (potência de 2)
+ * Retorno: void
+ */
+void redimensionarIndiceSuspeitos(unsigned int novaCapacidade) {
+    int* novoIndice = (int*)calloc(novaCapacidade, sizeof(int));
+    
+    if (novoIndice == NULL) {
+        printf("Erro: Não foi possível alocar memória para o registro de suspeitos.\n");
+        exit(1);
+    }
+    
+    // Reposiciona cada suspeito usando o hash armazenado do nome
+    unsigned int mascara = novaCapacidade - 1;
+    for (int id = 0; id < suspeitos.quantidade; id++) {
+        unsigned int indice = strings.hashes[suspeitos.nomes[id]] & mascara;
+        while (novoIndice[indice] != 0) {
+            indice = (indice + 1) & mascara;
+        }
+        novoIndice[indice] = id + 1;
+    }
+    
+    free(suspeitos.indice);
+    suspeitos.indice = novoIndice;
+    suspeitos.capacidadeIndice = novaCapacidade;
+}
+
+/*
+ * Função: registrarSuspeito
+ * Propósito: Obtém o identificador de um suspeito, cadastrando-o se ainda não existir
+ * Parâmetros: nome - identificador do nome do suspeito na tabela de strings
+ * Retorno: identificador do suspeito (posição no registro)
+ */
+int registrarSuspeito(uint32_t nome) {
+    // Mantém o índice com fator de carga abaixo do limite
+    if ((unsigned int)(suspeitos.quantidade + 1) * 100 > suspeitos.capacidadeIndice * CARGA_MAXIMA_HASH) {
+        redimensionarIndiceSuspeitos(suspeitos.capacidadeIndice > 0 ? suspeitos.capacidadeIndice * 2
+                                                                    : CAPACIDADE_SUSPEITOS_INICIAL);
+    }
+    
+    unsigned int mascara = suspeitos.capacidadeIndice - 1;
+    unsigned int indice = strings.hashes[nome] & mascara;
+    
+    // Sondagem linear: nomes internados são comparados pelo identificador
+    while (suspeitos.indice[indice] != 0) {
+        if (suspeitos.nomes[suspeitos.indice[indice] - 1] == nome) {
+            return suspeitos.indice[indice] - 1;
+        }
+        indice = (indice + 1) & mascara;
+    }
+    
+    // Novo suspeito: cresce o vetor se necessário
+    if (suspeitos.quantidade == suspeitos.capacidade) {
+        int novaCapacidade = suspeitos.capacidade > 0 ? suspeitos.capacidade * 2
+                                                      : CAPACIDADE_SUSPEITOS_INICIAL;
+        uint32_t* novosNomes = (uint32_t*)realloc(suspeitos.nomes, novaCapacidade * sizeof(uint32_t));
+        if (novosNomes == NULL) {
+            printf("Erro: Não foi possível alocar memória para o registro de suspeitos.\n");
+            exit(1);
+        }
+        suspeitos.nomes = novosNomes;
+        suspeitos.capacidade = novaCapacidade;
+    }
+    
+    int id = suspeitos.quantidade++;
+    suspeitos.nomes[id] = nome;
+    suspeitos.indice[indice] = id + 1;
+    
+    return id;
+}
+
+/*
+ * Função: buscarSuspeito
+ * Propósito: Consulta o identificador de um suspeito sem cadastrá-lo
+ * Parâmetros: nome - identificador do nome na tabela de strings (STRING_INEXISTENTE aceito)
+ * Retorno: identificador do suspeito ou -1 se não houver suspeito com esse nome
+ */
+int buscarSuspeito(uint32_t nome) {
+    if (nome == STRING_INEXISTENTE || suspeitos.capacidadeIndice == 0) {
+        return -1;
+    }
+    
+    unsigned int mascara = suspeitos.capacidadeIndice - 1;
+    for (unsigned int indice = strings.hashes[nome] & mascara; suspeitos.indice[indice] != 0;
+         indice = (indice + 1) & mascara) {
+        if (suspeitos.nomes[suspeitos.indice[indice] - 1] == nome) {
+            return suspeitos.indice[indice] - 1;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Função: redimensionarTabelaHash
+ * Propósito: Realoca a tabela hash com nova capacidade e reposiciona as entradas
+ * Parâmetros: novaCapacidade - nova quantidade de posições (potência de 2)
+ * Retorno: void
+ */
+void redimensionarTabelaHash(unsigned int novaCapacidade) {
+    HashNode* novasEntradas = (HashNode*)calloc(novaCapacidade, sizeof(HashNode));
+    
+    if (novasEntradas == NULL) {
+        printf("Erro: Não foi possível alocar memória para a tabela hash.\n");
+        exit(1);
+    }
+    
+    // Reposiciona as entradas usando o hash guardado na tabela de strings (sem recalcular)
+    unsigned int mascara = novaCapacidade - 1;
+    for (unsigned int i = 0; i < tabelaHash.capacidade; i++) {
+        if (tabelaHash.entradas[i].pista != STRING_VAZIA) {
+            unsigned int indice = strings.hashes[tabelaHash.entradas[i].pista] & mascara;
+            while (novasEntradas[indice].pista != STRING_VAZIA) {
+                indice = (indice + 1) & mascara;
+            }
+            novasEntradas[indice] = tabelaHash.entradas[i];
+        }
+    }
+    
+    free(tabelaHash.entradas);
+    tabelaHash.entradas = novasEntradas;
+    tabelaHash.capacidade = novaCapacidade;
+}
+
+/*
+ * Função: inicializarTabelaHash
+ * Propósito: Inicializa a tabela hash vazia (as associações vêm do arquivo de caso)
+ * Parâmetros: void
+ * Retorno: void
+ */
+void inicializarTabelaHash() {
+    // Aloca as posições iniciais (todas livres)
+    redimensionarTabelaHash(CAPACIDADE_HASH_INICIAL);
+}
+
+/*
+ * Função: inserirNaHash
+ * Propósito: Insere associação pista/suspeito na tabela hash
+ * Parâmetros: pista - string com a pista (chave, não vazia)
+ *            suspeito - string com o suspeito (valor)
+ * Retorno: void
+ */
+void inserirNaHash(const char* pista, const char* suspeito) {
+    // Cresce a tabela antes de ultrapassar o fator de carga máximo
+    if ((tabelaHash.ocupadas + 1) * 100 > tabelaHash.capacidade * CARGA_MAXIMA_HASH) {
+        redimensionarTabelaHash(tabelaHash.capacidade > 0 ? tabelaHash.capacidade * 2
+                                                          : CAPACIDADE_HASH_INICIAL);
+    }
+    
+    uint32_t idPista = internarString(pista);
+    int idSuspeito = registrarSuspeito(internarString(suspeito));
+    unsigned int mascara = tabelaHash.capacidade - 1;
+    unsigned int indice = strings.hashes[idPista] & mascara;
+    
+    // Sondagem linear até encontrar a mesma pista ou uma posição livre
+    while (tabelaHash.entradas[indice].pista != STRING_VAZIA) {
+        if (tabelaHash.entradas[indice].pista == idPista) {
+            // Pista já cadastrada: a associação mais recente prevalece
+            tabelaHash.entradas[indice].idSuspeito = idSuspeito;
+            return;
+        }
+        indice = (indice + 1) & mascara;
+    }
+    
+    tabelaHash.entradas[indice].pista = idPista;
+    tabelaHash.entradas[indice].idSuspeito = idSuspeito;
+    tabelaHash.ocupadas++;
+}
+
+/*
+ * Função: sondarTabela
+ * Propósito: Sondagem linear a partir de uma posição inicial. Com SSE2/AVX2 compara
+ *            as pistas de SONDAGEM_SIMD entradas por instrução (a pista internada é
+ *            a própria impressão digital da chave); perto do fim da tabela, onde a
+ *            sondagem dá a volta, segue entrada a entrada
+ * Parâmetros: pista - identificador da pista (diferente de STRING_VAZIA)
+ *            indice - posição inicial da sondagem
+ * Retorno: ponteiro para a associação encontrada ou NULL se não encontrada
+ */
+static inline HashNode* sondarTabela(uint32_t pista, unsigned int indice) {
+    unsigned int mascara = tabelaHash.capacidade - 1;
+    INSTRUMENTAR(unsigned int inicioSondagem = indice;)
+    
+#if SONDAGEM_SIMD > 1
+    while (indice + SONDAGEM_SIMD <= tabelaHash.capacidade) {
+        HashNode* grupo = &tabelaHash.entradas[indice];
+#if defined(__AVX2__)
+        __m256i entradas = _mm256_loadu_si256((const __m256i*)grupo);
+        unsigned int iguais = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(entradas, _mm256_set1_epi32((int)pista))));
+        unsigned int livres = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(entradas, _mm256_setzero_si256())));
+#else
+        __m128i entradas = _mm_loadu_si128((const __m128i*)grupo);
+        unsigned int iguais = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(
+            _mm_cmpeq_epi32(entradas, _mm_set1_epi32((int)pista))));
+        unsigned int livres = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(
+            _mm_cmpeq_epi32(entradas, _mm_setzero_si128())));
+#endif
+        // Só as colunas pares (campo "pista" de cada HashNode) interessam
+        iguais &= MASCARA_PISTAS_SIMD;
+        livres &= MASCARA_PISTAS_SIMD;
+        if ((iguais | livres) != 0) {
+            // A primeira entrada igual ou livre decide, como na sondagem escalar
+            unsigned int coluna = (unsigned int)__builtin_ctz(iguais | livres);
+            HashNode* encontrada = (iguais >> coluna) & 1 ? &grupo[coluna / 2] : NULL;
+            INSTRUMENTAR(registrarSondagem(METRICA_SONDAGENS_PISTAS, indice + coluna / 2 - inicioSondagem + 1);
+                         somarMetrica(METRICA_BUSCAS_SEM_SUCESSO, encontrada == NULL);)
+            return encontrada;
+        }
+        indice += SONDAGEM_SIMD;
+    }
+    indice &= mascara;
+#endif
+    
+    // Percorre as posições a partir do índice até uma posição livre
+    while (tabelaHash.entradas[indice].pista != STRING_VAZIA) {
+        if (tabelaHash.entradas[indice].pista == pista) {
+            INSTRUMENTAR(registrarSondagem(METRICA_SONDAGENS_PISTAS, ((indice - inicioSondagem) & mascara) + 1);)
+            return &tabelaHash.entradas[indice];
+        }
+        indice = (indice + 1) & mascara;
+    }
+    
+    INSTRUMENTAR(registrarSondagem(METRICA_SONDAGENS_PISTAS, ((indice - inicioSondagem) & mascara) + 1);
+                 somarMetrica(METRICA_BUSCAS_SEM_SUCESSO, 1);)
+    return NULL; // Pista não encontrada
+}
+
+/*
+ * Função: buscarNaHash
+ * Propósito: Localiza a associação de uma pista internada na tabela hash
+ * Parâmetros: pista - identificador da pista na tabela de strings
+ * Retorno: ponteiro para a associação encontrada ou NULL se não encontrada
+ */
+HashNode* buscarNaHash(uint32_t pista) {
+    if (tabelaHash.capacidade == 0 || pista == STRING_VAZIA) {
+        return NULL;
+    }
+    
+    return sondarTabela(pista, strings.hashes[pista] & (tabelaHash.capacidade - 1));
+}
+
+/*
+ * Função: buscarSuspeitosEmLote
+ * Propósito: Consulta o suspeito de várias pistas de uma vez. As pistas são tratadas
+ *            em grupos de LOTE_BUSCA: os hashes do grupo seguinte e as posições da
+ *            tabela do grupo atual são antecipados antes das sondagens, de modo que
+ *            as faltas de cache se sobrepõem em vez de serem esperadas uma a uma
+ * Parâmetros: pistas - identificadores das pistas (STRING_VAZIA é aceita)
+ *            quantidade - número de pistas
+ *            idsSuspeitos - recebe o suspeito de cada pista (-1 se não houver)
+ * Retorno: void
+ */
+void buscarSuspeitosEmLote(const uint32_t* pistas, size_t quantidade, int* idsSuspeitos) {
+    if (tabelaHash.capacidade == 0) {
+        for (size_t i = 0; i < quantidade; i++) {
+            idsSuspeitos[i] = -1;
+        }
+        return;
+    }
+    
+    unsigned int mascara = tabelaHash.capacidade - 1;
+    unsigned int indices[LOTE_BUSCA];
+    
+    for (size_t i = 0; i < quantidade && i < LOTE_BUSCA; i++) {
+        prefetchar(&strings.hashes[pistas[i]]);
+    }
+    for (size_t inicio = 0; inicio < quantidade; inicio += LOTE_BUSCA) {
+        size_t fim = inicio + LOTE_BUSCA < quantidade ? inicio + LOTE_BUSCA : quantidade;
+        
+        // Hashes do próximo grupo
+        for (size_t i = fim; i < quantidade && i < fim + LOTE_BUSCA; i++) {
+            prefetchar(&strings.hashes[pistas[i]]);
+        }
+        
+        // Posições iniciais deste grupo
+        for (size_t i = inicio; i < fim; i++) {
+            indices[i - inicio] = strings.hashes[pistas[i]] & mascara;
+            prefetchar(&tabelaHash.entradas[indices[i - inicio]]);
+        }
+        
+        // Sondagens, já com as entradas a caminho do cache
+        for (size_t i = inicio; i < fim; i++) {
+            HashNode* associacao = pistas[i] != STRING_VAZIA
+                ? sondarTabela(pistas[i], indices[i - inicio]) : NULL;
+            idsSuspeitos[i] = associacao != NULL ? associacao->idSuspeito : -1;
+        }
+    }
+}
+
+/*
+ * Função: nomeDoSuspeitoDaPista
+ * Propósito: Consulta o nome do suspeito de uma pista já internada
+ * Parâmetros: pista - identificador da pista na tabela de strings
+ * Retorno: ponteiro para string com nome do suspeito ou NULL se não encontrado
+ */
+const char* nomeDoSuspeitoDaPista(uint32_t pista) {
+    HashNode* associacao = buscarNaHash(pista);
+    return associacao != NULL ? textoDaString(suspeitos.nomes[associacao->idSuspeito]) : NULL;
+}
+
+/*
+ * Função: encontrarSuspeito
+ * Propósito: Consulta o suspeito correspondente a uma pista na tabela hash
+ * Parâmetros: pista - string com a pista a ser consultada
+ * Retorno: ponteiro para string com nome do suspeito ou NULL se não encontrado
+ */
+const char* encontrarSuspeito(const char* pista) {
+    uint32_t idPista = buscarString(pista);
+    return idPista != STRING_INEXISTENTE ? nomeDoSuspeitoDaPista(idPista) : NULL;
+}
+
+/*
+ * Função: liberarMemoriaHash
+ * Propósito: Libera o vetor de posições da tabela hash
+ * Parâmetros: void
+ * Retorno: void
+ */
+void liberarMemoriaHash() {
+    free(tabelaHash.entradas);
+    tabelaHash.entradas = NULL;
+    tabelaHash.capacidade = 0;
+    tabelaHash.ocupadas = 0;
+}
+
+/*
+ * Função: liberarMemoriaSuspeitos
+ * Propósito: Libera o registro de suspeitos e seu índice
+ * Parâmetros: void
+ * Retorno: void
+ */
+void liberarMemoriaSuspeitos() {
+    free(suspeitos.nomes);
+    free(suspeitos.indice);
+    suspeitos.nomes = NULL;
+    suspeitos.indice = NULL;
+    suspeitos.quantidade = 0;
+    suspeitos.capacidade = 0;
+    suspeitos.capacidadeIndice = 0;
+}
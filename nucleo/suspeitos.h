@@ -0,0 +1,51 @@
+#ifndef NUCLEO_SUSPEITOS_H
+#define NUCLEO_SUSPEITOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "textos.h"
+
+#define CAPACIDADE_HASH_INICIAL 16       // Capacidade inicial da tabela hash (potência de 2)
+#define CAPACIDADE_SUSPEITOS_INICIAL 16  // Capacidade inicial do registro de suspeitos
+#define LOTE_BUSCA 16                    // Consultas antecipadas juntas na busca em lote
+
+// Associação pista -> suspeito, guardada diretamente nas posições da tabela hash
+typedef struct HashNode {
+    uint32_t pista;               // Chave: identificador da pista (STRING_VAZIA = posição livre)
+    int idSuspeito;               // Valor: identificador do suspeito no registro
+} HashNode;
+
+// Tabela hash redimensionável pista -> suspeito (endereçamento aberto com sondagem linear)
+typedef struct TabelaHash {
+    HashNode* entradas;           // Vetor contíguo de posições
+    unsigned int capacidade;      // Número de posições (sempre potência de 2)
+    unsigned int ocupadas;        // Número de posições em uso
+} TabelaHash;
+
+// Registro dinâmico de suspeitos: o identificador de cada suspeito é sua posição em "nomes"
+typedef struct RegistroSuspeitos {
+    uint32_t* nomes;              // Nome de cada suspeito (identificador na tabela de strings)
+    int quantidade;               // Número de suspeitos registrados
+    int capacidade;               // Capacidade alocada de "nomes"
+    int* indice;                  // Endereçamento aberto: identificador + 1 (0 = livre)
+    unsigned int capacidadeIndice; // Número de posições do índice (potência de 2)
+} RegistroSuspeitos;
+
+extern TabelaHash tabelaHash;
+extern RegistroSuspeitos suspeitos;
+
+void redimensionarIndiceSuspeitos(unsigned int novaCapacidade);
+int registrarSuspeito(uint32_t nome);
+int buscarSuspeito(uint32_t nome);
+void redimensionarTabelaHash(unsigned int novaCapacidade);
+void inicializarTabelaHash();
+void inserirNaHash(const char* pista, const char* suspeito);
+HashNode* buscarNaHash(uint32_t pista);
+void buscarSuspeitosEmLote(const uint32_t* pistas, size_t quantidade, int* idsSuspeitos);
+const char* nomeDoSuspeitoDaPista(uint32_t pista);
+const char* encontrarSuspeito(const char* pista);
+void liberarMemoriaHash();
+void liberarMemoriaSuspeitos();
+
+#endif
@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "textos.h"
+#include "instrumentacao.h"
+
+// Constantes de mistura da função hash (mesmas do wyhash)
+#define HASH_P0 0xa0761d6478bd642fULL
+#define HASH_P1 0xe7037ed1a0b428dbULL
+#define HASH_P2 0x8ebc6af09c88c6e3ULL
+
+// Tabela de strings do caso carregado
+TabelaStrings strings = {NULL, 0, 0, NULL, NULL, 0, 0, NULL, 0};
+
+/*
+ * Função: misturarHash
+ * Propósito: Multiplica dois valores de 64 bits e combina as metades do produto de 128 bits
+ * Parâmetros: a, b - valores a serem misturados
+ * Retorno: XOR entre a metade alta e a metade baixa do produto
+ */
+static inline uint64_t misturarHash(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t produto = (__uint128_t)a * b;
+    return (uint64_t)produto ^ (uint64_t)(produto >> 64);
+#else
+    // Multiplicação 64x64 -> 128 em partes de 32 bits
+    uint64_t ha = a >> 32, la = (uint32_t)a, hb = b >> 32, lb = (uint32_t)b;
+    uint64_t alto = ha * hb, meio0 = ha * lb, meio1 = hb * la, baixo = la * lb;
+    uint64_t t = baixo + (meio0 << 32);
+    uint64_t vaiUm = t < baixo;
+    uint64_t resultadoBaixo = t + (meio1 << 32);
+    vaiUm += resultadoBaixo < t;
+    uint64_t resultadoAlto = alto + (meio0 >> 32) + (meio1 >> 32) + vaiUm;
+    return resultadoBaixo ^ resultadoAlto;
+#endif
+}
+
+/*
+ * Função: lerPalavra
+ * Propósito: Lê 8 bytes não alinhados de uma string como inteiro de 64 bits
+ * Parâmetros: p - ponteiro para os bytes
+ * Retorno: palavra de 64 bits
+ */
+static inline uint64_t lerPalavra(const unsigned char* p) {
+    uint64_t palavra;
+    memcpy(&palavra, p, sizeof(palavra));
+    return palavra;
+}
+
+/*
+ * Função: funcaoHash
+ * Propósito: Calcula o hash de 64 bits de uma string, 8 bytes por vez (estilo wyhash)
+ * Parâmetros: chave - string para calcular hash
+ * Retorno: hash de 64 bits (o índice é obtido com a máscara da tabela)
+ */
+uint64_t funcaoHash(const char* chave) {
+    const unsigned char* p = (const unsigned char*)chave;
+    size_t tamanho = strlen(chave);
+    size_t restante = tamanho;
+    uint64_t semente = HASH_P0;
+    
+    // Consome blocos de 16 bytes (duas palavras) por iteração
+    while (restante > 16) {
+        semente = misturarHash(lerPalavra(p) ^ HASH_P1, lerPalavra(p + 8) ^ semente);
+        p += 16;
+        restante -= 16;
+    }
+    
+    // Últimos 1 a 16 bytes, completados com zeros
+    uint64_t a = 0, b = 0;
+    if (restante > 8) {
+        a = lerPalavra(p);
+        memcpy(&b, p + 8, restante - 8);
+    } else {
+        memcpy(&a, p, restante);
+    }
+    
+    return misturarHash(HASH_P1 ^ tamanho, misturarHash(a ^ HASH_P1, b ^ semente) ^ HASH_P2);
+}
+
+/*
+ * Função: redimensionarIndiceStrings
+ * Propósito: Reconstrói o índice da tabela de strings com nova capacidade
+ * Parâmetros: novaCapacidade - nova quantidade de posições (potência de 2)
+ * Retorno: void
+ */
+void redimensionarIndiceStrings(uint32_t novaCapacidade) {
+    uint32_t* novoIndice = (uint32_t*)calloc(novaCapacidade, sizeof(uint32_t));
+    
+    if (novoIndice == NULL) {
+        printf("Erro: Não foi possível alocar memória para a tabela de strings.\n");
+        exit(1);
+    }
+    
+    // Reposiciona cada string usando o hash armazenado
+    uint32_t mascara = novaCapacidade - 1;
+    for (uint32_t id = 0; id < strings.quantidade; id++) {
+        uint32_t indice = strings.hashes[id] & mascara;
+        while (novoIndice[indice] != 0) {
+            indice = (indice + 1) & mascara;
+        }
+        novoIndice[indice] = id + 1;
+    }
+    
+    free(strings.indice);
+    strings.indice = novoIndice;
+    strings.capacidadeIndice = novaCapacidade;
+}
+
+/*
+ * Função: localizarString
+ * Propósito: Sonda o índice de strings em busca de um texto
+ * Parâmetros: texto - texto procurado
+ *            hash - hash do texto
+ * Retorno: posição do índice com o texto ou a posição livre onde ele entraria
+ */
+uint32_t localizarString(const char* texto, uint64_t hash) {
+    uint32_t mascara = strings.capacidadeIndice - 1;
+    uint32_t indice = hash & mascara;
+    
+    while (strings.indice[indice] != 0) {
+        uint32_t id = strings.indice[indice] - 1;
+        if (strings.hashes[id] == hash && strcmp(textoDaString(id), texto) == 0) {
+            break;
+        }
+        indice = (indice + 1) & mascara;
+    }
+    
+    INSTRUMENTAR(registrarSondagem(METRICA_SONDAGENS_STRINGS, ((indice - (uint32_t)hash) & mascara) + 1);)
+    return indice;
+}
+
+/*
+ * Função: buscarString
+ * Propósito: Consulta o identificador de um texto sem interná-lo
+ * Parâmetros: texto - texto procurado
+ * Retorno: identificador da string ou STRING_INEXISTENTE
+ */
+uint32_t buscarString(const char* texto) {
+    if (strings.capacidadeIndice == 0) {
+        return STRING_INEXISTENTE;
+    }
+    
+    uint32_t indice = localizarString(texto, funcaoHash(texto));
+    return strings.indice[indice] != 0 ? strings.indice[indice] - 1 : STRING_INEXISTENTE;
+}
+
+/*
+ * Função: internarString
+ * Propósito: Obtém o identificador de um texto, copiando-o para a tabela se for novo
+ * Parâmetros: texto - texto a ser internado
+ * Retorno: identificador de 32 bits da string
+ */
+uint32_t internarString(const char* texto) {
+    // Mantém o índice com fator de carga abaixo do limite
+    if ((strings.quantidade + 1) * 100 > (uint64_t)strings.capacidadeIndice * CARGA_MAXIMA_HASH) {
+        redimensionarIndiceStrings(strings.capacidadeIndice > 0 ? strings.capacidadeIndice * 2
+                                                                : CAPACIDADE_STRINGS_INICIAL);
+    }
+    
+    uint64_t hash = funcaoHash(texto);
+    uint32_t indice = localizarString(texto, hash);
+    if (strings.indice[indice] != 0) {
+        return strings.indice[indice] - 1; // Já internada
+    }
+    
+    // Os deslocamentos são de 32 bits: truncá-los corromperia as strings já internadas
+    size_t tamanho = strlen(texto) + 1;
+    if (strings.tamanhoTexto + tamanho > UINT32_MAX) {
+        printf("Erro: O texto das strings passa do limite de 4 GiB da tabela de strings.\n");
+        exit(1);
+    }
+    
+    // Cresce o buffer de texto se necessário
+    if (strings.tamanhoTexto + tamanho > strings.capacidadeTexto) {
+        size_t novaCapacidade = strings.capacidadeTexto > 0 ? strings.capacidadeTexto * 2
+                                                            : CAPACIDADE_TEXTO_INICIAL;
+        while (strings.tamanhoTexto + tamanho > novaCapacidade) {
+            novaCapacidade *= 2;
+        }
+        char* novoTexto = (char*)realloc(strings.texto, novaCapacidade);
+        if (novoTexto == NULL) {
+            printf("Erro: Não foi possível alocar memória para a tabela de strings.\n");
+            exit(1);
+        }
+        strings.texto = novoTexto;
+        strings.capacidadeTexto = novaCapacidade;
+    }
+    
+    // Cresce os vetores por identificador se necessário
+    if (strings.quantidade == strings.capacidade) {
+        uint32_t novaCapacidade = strings.capacidade > 0 ? strings.capacidade * 2
+                                                         : CAPACIDADE_STRINGS_INICIAL;
+        uint32_t* novosDeslocamentos = (uint32_t*)realloc(strings.deslocamentos,
+                                                          novaCapacidade * sizeof(uint32_t));
+        uint64_t* novosHashes = (uint64_t*)realloc(strings.hashes, novaCapacidade * sizeof(uint64_t));
+        if (novosDeslocamentos == NULL || novosHashes == NULL) {
+            printf("Erro: Não foi possível alocar memória para a tabela de strings.\n");
+            exit(1);
+        }
+        strings.deslocamentos = novosDeslocamentos;
+        strings.hashes = novosHashes;
+        strings.capacidade = novaCapacidade;
+    }
+    
+    uint32_t id = strings.quantidade++;
+    memcpy(strings.texto + strings.tamanhoTexto, texto, tamanho);
+    strings.deslocamentos[id] = (uint32_t)strings.tamanhoTexto;
+    strings.hashes[id] = hash;
+    strings.tamanhoTexto += tamanho;
+    strings.indice[indice] = id + 1;
+    
+    return id;
+}
+
+/*
+ * Função: inicializarTabelaStrings
+ * Propósito: Prepara a tabela de strings reservando o identificador da string vazia
+ * Parâmetros: void
+ * Retorno: void
+ */
+void inicializarTabelaStrings() {
+    internarString(""); // Recebe o identificador STRING_VAZIA
+}
+
+/*
+ * Função: liberarMemoriaStrings
+ * Propósito: Libera o buffer de texto e os vetores da tabela de strings
+ * Parâmetros: void
+ * Retorno: void
+ */
+void liberarMemoriaStrings() {
+    free(strings.texto);
+    free(strings.deslocamentos);
+    free(strings.hashes);
+    free(strings.indice);
+    memset(&strings, 0, sizeof(strings));
+}
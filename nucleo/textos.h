@@ -0,0 +1,46 @@
+#ifndef NUCLEO_TEXTOS_H
+#define NUCLEO_TEXTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CARGA_MAXIMA_HASH 70             // Fator de carga máximo (%) antes de redimensionar
+#define CAPACIDADE_STRINGS_INICIAL 64    // Capacidade inicial de strings internadas
+#define CAPACIDADE_TEXTO_INICIAL 4096    // Capacidade inicial do buffer de texto (bytes)
+#define STRING_VAZIA 0                   // Identificador reservado para "" (sala sem pista)
+#define STRING_INEXISTENTE UINT32_MAX    // Texto que nunca foi internado
+
+// Tabela de strings internadas: cada texto distinto é guardado uma única vez
+typedef struct TabelaStrings {
+    char* texto;                  // Buffer contíguo com todas as strings (terminadas em '\0')
+    size_t tamanhoTexto;          // Bytes usados em "texto"
+    size_t capacidadeTexto;       // Bytes alocados em "texto"
+    uint32_t* deslocamentos;      // Início de cada string em "texto" (indexado pelo identificador)
+    uint64_t* hashes;             // Hash de cada string, calculado uma única vez
+    uint32_t quantidade;          // Número de strings internadas
+    uint32_t capacidade;          // Capacidade de "deslocamentos" e "hashes"
+    uint32_t* indice;             // Endereçamento aberto: identificador + 1 (0 = livre)
+    uint32_t capacidadeIndice;    // Número de posições do índice (potência de 2)
+} TabelaStrings;
+
+extern TabelaStrings strings;
+
+/*
+ * Função: textoDaString
+ * Propósito: Obtém o texto de uma string internada
+ * Parâmetros: id - identificador da string
+ * Retorno: ponteiro para o texto (válido até a próxima chamada de internarString)
+ */
+static inline const char* textoDaString(uint32_t id) {
+    return strings.texto + strings.deslocamentos[id];
+}
+
+uint64_t funcaoHash(const char* chave);
+void redimensionarIndiceStrings(uint32_t novaCapacidade);
+uint32_t localizarString(const char* texto, uint64_t hash);
+uint32_t buscarString(const char* texto);
+uint32_t internarString(const char* texto);
+void inicializarTabelaStrings();
+void liberarMemoriaStrings();
+
+#endif
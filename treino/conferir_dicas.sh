@@ -0,0 +1,159 @@
+#!/bin/sh
+# Conferência das dicas do nível mestre contra uma busca exaustiva: gera casos pequenos
+# aleatórios (árvores de ligações, passagens e suspeitos), joga um roteiro aleatório que
+# pede uma dica (h) a cada passo e volta (v) de vez em quando, e confere o veredito de
+# cada saída com uma busca em profundidade por todos os caminhos da subárvore dela.
+#
+# Uso: treino/conferir_dicas.sh <binário do nível mestre> [número de casos]
+set -e
+
+binario=$1
+casos=${2:-300}
+tmp=${TMPDIR:-/tmp}/conferir.$$
+mkdir -p "$tmp"
+trap 'rm -rf "$tmp"' EXIT
+
+falhas=0
+semente=1
+while [ "$semente" -le "$casos" ]; do
+    # Caso e roteiro: salas sem pai (raízes extras) só são alcançadas por passagens
+    awk -v semente="$semente" -v caso="$tmp/caso.txt" -v roteiro="$tmp/roteiro.txt" 'BEGIN {
+        srand(semente)
+        n = 1 + int(rand() * 150)
+        numPistas = rand() < 0.5 ? 4 : 12
+        for (i = 0; i < n; i++) {
+            esq[i] = -1; dir[i] = -1; numPassagens[i] = 0
+        }
+        for (i = 1; i < n; i++)
+            for (t = 0; t < 50; t++) {
+                p = int(rand() * i)
+                if (rand() < 0.5) {
+                    if (esq[p] < 0) { esq[p] = i; break }
+                } else if (dir[p] < 0) { dir[p] = i; break }
+            }
+        for (i = 0; i < n; i++)
+            if (rand() < 0.3) printf "S\t%d\tR%d\n", i, i > caso
+            else printf "S\t%d\tR%d\tc%d\n", i, i, int(rand() * numPistas) > caso
+        for (i = 0; i < n; i++)
+            if (esq[i] >= 0 || dir[i] >= 0)
+                printf "L\t%d\t%s\t%s\n", i, esq[i] < 0 ? "-" : esq[i], dir[i] < 0 ? "-" : dir[i] > caso
+        for (k = int(rand() * n / 2); k > 0; k--) {
+            origem = int(rand() * n)
+            destino = int(rand() * n)
+            passagem[origem, ++numPassagens[origem]] = destino
+            printf "C\t%d\t%d\n", origem, destino > caso
+        }
+        for (k = 0; k < numPistas; k++)
+            if (rand() < 0.8) printf "P\tc%d\t%s\n", k, substr("ABCDE", 1 + int(rand() * 5), 1) > caso
+
+        sala = 0; topo = 0; jogadas = "h"
+        for (m = 0; m < 40; m++) {
+            grau = (esq[sala] >= 0) + (dir[sala] >= 0) + numPassagens[sala]
+            if (topo > 0 && (grau == 0 || rand() < 0.2)) {
+                sala = pilha[--topo]
+                jogadas = jogadas " v h"
+                continue
+            }
+            if (grau == 0) break
+            j = int(rand() * grau)
+            pilha[topo++] = sala
+            if (esq[sala] >= 0 && j-- == 0) { sala = esq[sala]; jogadas = jogadas " e h"; continue }
+            if (dir[sala] >= 0 && j-- == 0) { sala = dir[sala]; jogadas = jogadas " d h"; continue }
+            jogadas = jogadas " " (j + 1) " h"
+            sala = passagem[sala, j + 1]
+        }
+        print jogadas " s 0" > roteiro
+    }'
+    "$binario" --lote "$tmp/roteiro.txt" "$tmp/caso.txt" > "$tmp/saida.txt"
+
+    # Refaz o roteiro sobre o caso e confere cada bloco de dica da saída
+    if ! awk -F '\t' -v semente="$semente" '
+        function pode(sala, alvo,    pista, suspeito, pontuou, achou) {
+            pista = pistaDaSala[sala]; pontuou = 0; achou = 0
+            if (pista != "" && vezes[pista]++ == 0 && (pista in suspeitoDaPista)) {
+                suspeito = suspeitoDaPista[pista]; pontuou = 1
+                if (++contagem[suspeito] >= 2 && (alvo == "" || suspeito == alvo)) achou = 1
+            }
+            if (!achou && esq[sala] >= 0) achou = pode(esq[sala], alvo)
+            if (!achou && dir[sala] >= 0) achou = pode(dir[sala], alvo)
+            if (pista != "") vezes[pista]--
+            if (pontuou) contagem[suspeito]--
+            return achou
+        }
+        function coletar(sala,    pista) {
+            pista = pistaDaSala[sala]
+            if (pista == "" || vezes[pista]++ > 0) return ""
+            if (pista in suspeitoDaPista) contagem[suspeitoDaPista[pista]]++
+            return pista
+        }
+        function falha(motivo) {
+            print "caso " semente ", dica " bloco ": " motivo
+            ok = 0
+        }
+        FILENAME == ARGV[1] {
+            if ($1 == "S") { pistaDaSala[$2] = $4; esq[$2] = -1; dir[$2] = -1 }
+            if ($1 == "L") { esq[$2] = $3 == "-" ? -1 : $3; dir[$2] = $4 == "-" ? -1 : $4 }
+            if ($1 == "C") passagem[$2, ++numPassagens[$2]] = $3
+            if ($1 == "P") suspeitoDaPista[$2] = $3
+            next
+        }
+        FILENAME == ARGV[2] { numJogadas = split($0, jogada, " "); next }
+        /DICA:$/ { numBlocos++; dentro = 1; next }
+        dentro && /^   / { linhas[numBlocos, ++numLinhas[numBlocos]] = $0; next }
+        { dentro = 0 }
+        END {
+            ok = 1; sala = 0; topo = 0; bloco = 0
+            coletar(0)
+            for (m = 1; m <= numJogadas; m++) {
+                j = jogada[m]
+                if (j == "v") {
+                    if (novaPista[--topo] != "") {
+                        pista = novaPista[topo]; vezes[pista] = 0
+                        if (pista in suspeitoDaPista) contagem[suspeitoDaPista[pista]]--
+                    }
+                    sala = salaAnterior[topo]
+                } else if (j == "e" || j == "d" || j ~ /^[0-9]+$/) {
+                    salaAnterior[topo] = sala
+                    sala = j == "e" ? esq[sala] : j == "d" ? dir[sala] : passagem[sala, j]
+                    novaPista[topo++] = coletar(sala)
+                } else if (j == "h") {
+                    bloco++
+                    suficiente = ""
+                    for (s in contagem) if (contagem[s] >= 2) suficiente = s
+                    primeira = linhas[bloco, 1]
+                    if (suficiente != "") {
+                        if (!match(primeira, /suficientes contra [A-E]\./) ||
+                            contagem[substr(primeira, RSTART + 19, 1)] < 2)
+                            falha("esperava pistas suficientes: " primeira)
+                        continue
+                    }
+                    numSaidas = 0
+                    if (esq[sala] >= 0) { saida[++numSaidas] = esq[sala]; direcao[numSaidas] = "Esquerda" }
+                    if (dir[sala] >= 0) { saida[++numSaidas] = dir[sala]; direcao[numSaidas] = "Direita" }
+                    for (p = 1; p <= numPassagens[sala]; p++) {
+                        saida[++numSaidas] = passagem[sala, p]; direcao[numSaidas] = "Passagem " p
+                    }
+                    if (numSaidas == 0 && primeira !~ /Não há mais saídas/)
+                        falha("esperava sala sem saída: " primeira)
+                    for (i = 1; i <= numSaidas; i++) {
+                        linha = linhas[bloco, i]
+                        if (index(linha, "   " direcao[i] " (R" saida[i] "): ") != 1)
+                            falha("saída " i " fora de ordem: " linha)
+                        else if (match(linha, /ainda pode incriminar [A-E]$/)) {
+                            if (!pode(saida[i], substr(linha, RSTART + 22, 1)))
+                                falha("nenhum caminho incrimina o suspeito: " linha)
+                        } else if (pode(saida[i], ""))
+                            falha("algum caminho incrimina alguém: " linha)
+                    }
+                }
+            }
+            if (bloco != numBlocos) falha("esperava " bloco " dicas, a saída tem " numBlocos)
+            exit !ok
+        }' "$tmp/caso.txt" "$tmp/roteiro.txt" "$tmp/saida.txt"; then
+        falhas=$((falhas + 1))
+    fi
+    semente=$((semente + 1))
+done
+
+echo "Dicas conferidas em $casos casos: $falhas com divergência."
+[ "$falhas" -eq 0 ]
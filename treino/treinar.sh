@@ -0,0 +1,65 @@
+#!/bin/sh
+# Carga de treino do PGO: reproduz roteiros no modo lote (com e sem saída, com buscas
+# nas pistas) e, no nível mestre, sessões paralelas, dicas, compilação de imagem,
+# consultas de rotas e o resolvedor em um caso sintético gerado aqui mesmo.
+#
+# Uso: treino/treinar.sh <novato|aventureiro|mestre> <binário instrumentado>
+set -e
+
+nivel=$1
+binario=$2
+dir=$(dirname "$0")
+tmp=${TMPDIR:-/tmp}/treino.$$
+mkdir -p "$tmp"
+trap 'rm -rf "$tmp"' EXIT
+
+# Caso sintético: árvore binária completa, pista em 2 de cada 3 salas
+awk -v n=30000 'BEGIN {
+    for (i = 0; i < n; i++)
+        if (i % 3) printf "S\t%d\tSala %d\tPista %07d\n", i, i, i
+        else printf "S\t%d\tSala %d\n", i, i
+    for (i = 0; 2 * i + 1 < n; i++)
+        printf "L\t%d\t%d\t%s\n", i, 2 * i + 1, (2 * i + 2 < n) ? 2 * i + 2 : "-"
+    for (i = 0; i < n; i++)
+        if (i % 3) printf "P\tPista %07d\tSuspeito %d\n", i, i % 97
+}' > "$tmp/caso.txt"
+
+# Roteiros aleatórios (determinísticos) descendo pela árvore sintética
+awk 'BEGIN {
+    srand(42)
+    for (s = 0; s < 2000; s++) {
+        linha = ""
+        for (m = 0; m < 16; m++) linha = linha (rand() < 0.5 ? "e " : "d ") (rand() < 0.1 ? "h " : "")
+        if (s % 4 == 0) linha = linha "b " int(rand() * 1000) "; b pista 00" int(rand() * 10) "*; "
+        print linha "s " int(rand() * 5)
+    }
+}' > "$tmp/roteiros.txt"
+
+# Consultas de rotas (determinísticas) sobre o mesmo caso
+awk -v n=30000 'BEGIN {
+    srand(7)
+    for (c = 0; c < 3000; c++) {
+        printf "C\tSala %d\n", int(rand() * n)
+        printf "A\tSala 0\tSala %d\n", int(rand() * n)
+        if (c % 10 == 0) printf "P\tSala %d\tSuspeito %d\n", int(rand() * n), int(rand() * 8)
+    }
+}' > "$tmp/consultas.txt"
+
+# Roteiros da mansão padrão, um por vez, com e sem saída
+grep -v '^#' "$dir/roteiros.txt" | while read -r linha; do
+    printf '%s\n' "$linha" | "$binario" --lote - > /dev/null
+    printf '%s\n' "$linha" | "$binario" --lote - --silencioso > /dev/null
+done
+head -200 "$tmp/roteiros.txt" | while read -r linha; do
+    printf '%s\n' "$linha" | "$binario" --lote - "$tmp/caso.txt" > /dev/null
+done
+
+if [ "$nivel" = mestre ]; then
+    "$binario" --sessoes "$dir/roteiros.txt" --threads 2 > /dev/null
+    "$binario" --compilar "$tmp/caso.txt" "$tmp/caso.img" > /dev/null
+    "$binario" --sessoes "$tmp/roteiros.txt" --threads 2 "$tmp/caso.img" > /dev/null
+    "$binario" --sessoes "$tmp/roteiros.txt" --silencioso "$tmp/caso.img" > /dev/null
+    "$binario" --resolver --threads 2 "$tmp/caso.img" > /dev/null
+    "$binario" --consultar "$tmp/consultas.txt" "$tmp/caso.img" > /dev/null
+    "$binario" --ordem largura --sessoes "$tmp/roteiros.txt" --silencioso "$tmp/caso.txt" > /dev/null
+fi